@@ -0,0 +1,582 @@
+/**
+ * fbx2usd_native - FBX extraction for fbx2usd that runs without the GIL
+ *
+ * A Python extension module (pybind11) for the heavy per-frame and
+ * per-vertex work: sampling a whole take, extracting a mesh with its
+ * vertex colors, its skin weights and the scene bounds. Every call
+ * releases the GIL for its full duration, so a ThreadPoolExecutor gets
+ * real parallelism.
+ *
+ * The FBX Python bindings link their own copy of the SDK, so their objects
+ * can't be handed to this module. A Scene loads the file itself and
+ * converts it the way fbx2usd does (OpenGL axes, then centimeters). A
+ * Scene is used by one call at a time; use one Scene per worker thread to
+ * sample in parallel.
+ *
+ * Arrays are returned as Buffer objects, which Vt.*Array.FromBuffer reads
+ * directly.
+ *
+ *   import fbx2usd_native
+ *   scene = fbx2usd_native.Scene("character.fbx")
+ *   for translations, rotations, scales in scene.sample_clip(joint_names, "Take 001", 120, 30.0):
+ *       Vt.Vec3fArray.FromBuffer(translations)
+ *
+ * Build: make native-module
+ */
+
+#include "fbxscene_io.h"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+// ---------------------------------------------------------------------------
+// Buffers
+// ---------------------------------------------------------------------------
+
+// Typed array exposed through the buffer protocol: rows of `width` values
+struct Buffer {
+    std::vector<unsigned char> data;
+    std::string format;
+    size_t itemSize;
+    size_t rows;
+    size_t width;
+
+    template <typename T>
+    static Buffer Of(const std::vector<T>& values, size_t width) {
+        Buffer buffer;
+        buffer.format = py::format_descriptor<T>::format();
+        buffer.itemSize = sizeof(T);
+        buffer.width = width;
+        buffer.rows = values.size() / width;
+        buffer.data.resize(values.size() * sizeof(T));
+        if (!values.empty()) {
+            memcpy(buffer.data.data(), values.data(), buffer.data.size());
+        }
+        return buffer;
+    }
+
+    // 'e' (binary16) has no format_descriptor, so halves are stored as uint16
+    static Buffer Halves(const std::vector<uint16_t>& values, size_t width) {
+        Buffer buffer = Of(values, width);
+        buffer.format = "e";
+        return buffer;
+    }
+
+    py::buffer_info Info() {
+        py::ssize_t size = static_cast<py::ssize_t>(itemSize);
+        py::ssize_t rowCount = static_cast<py::ssize_t>(rows);
+        py::ssize_t rowWidth = static_cast<py::ssize_t>(width);
+        if (width == 1) {
+            return py::buffer_info(data.data(), size, format, 1, { rowCount }, { size });
+        }
+        return py::buffer_info(data.data(), size, format, 2, { rowCount, rowWidth }, { size * rowWidth, size });
+    }
+};
+
+// Round to the nearest half-float, ties to even, as GfHalf does
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7fffffff;
+    uint32_t exponent = magnitude >> 23;
+
+    if (magnitude > 0x7f800000) {
+        return static_cast<uint16_t>(sign | 0x7e00);  // NaN
+    }
+    if (magnitude >= 0x47800000) {
+        return static_cast<uint16_t>(sign | 0x7c00);  // Overflows to infinity
+    }
+
+    uint32_t half, remainder, halfway;
+    if (exponent < 113) {
+        // Subnormal half (or zero)
+        if (exponent < 102) {
+            return static_cast<uint16_t>(sign);
+        }
+        uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+        uint32_t shift = 126 - exponent;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        half = ((exponent - 112) << 10) | ((magnitude >> 13) & 0x3ff);
+        remainder = magnitude & 0x1fff;
+        halfway = 0x1000;
+    }
+
+    // A carry out of the mantissa bumps the exponent, up to infinity
+    if (remainder > halfway || (remainder == halfway && (half & 1))) {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+// ---------------------------------------------------------------------------
+// Scene
+// ---------------------------------------------------------------------------
+
+// Same conversion as load_fbx_scene in fbx2usd
+void PrepareScene(FbxScene* scene) {
+    FbxAxisSystem::OpenGL.ConvertScene(scene);
+
+    FbxSystemUnit sceneUnit = scene->GetGlobalSettings().GetSystemUnit();
+    if (sceneUnit.GetScaleFactor() != 1.0) {
+        FbxSystemUnit(1.0).ConvertScene(scene);
+    }
+}
+
+class Scene {
+public:
+    explicit Scene(const std::string& path) : manager_(nullptr), scene_(nullptr) {
+        {
+            py::gil_scoped_release release;
+            manager_ = CreateFbxManager();
+            if (manager_) {
+                scene_ = LoadFbxScene(manager_, path.c_str());
+            }
+            if (scene_) {
+                PrepareScene(scene_);
+            }
+        }
+        if (!scene_) {
+            if (manager_) {
+                manager_->Destroy();
+            }
+            throw std::runtime_error("Failed to load FBX file: " + path);
+        }
+    }
+
+    ~Scene() {
+        manager_->Destroy();
+    }
+
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+
+    // Local joint transforms for frame_count frames of a take at fps, starting
+    // at the take's start time: a list of (translations, rotations, scales)
+    // per frame, with rotations as (x, y, z, w) like GfQuatf and scales as
+    // halves
+    py::list SampleClip(const std::vector<std::string>& jointNames, const std::string& stackName,
+                        int frameCount, double fps) {
+        if (!(fps > 0)) {
+            throw py::value_error("fps must be positive");
+        }
+
+        std::vector<Buffer> frames;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            std::vector<FbxNode*> joints = FindNodes(jointNames);
+            FbxAnimStack* stack = FindAnimStack(stackName);
+            scene_->SetCurrentAnimationStack(stack);
+            double startTime = stack->GetLocalTimeSpan().GetStart().GetSecondDouble();
+            FbxAnimEvaluator* evaluator = scene_->GetAnimationEvaluator();
+
+            size_t jointCount = joints.size();
+            frames.reserve(static_cast<size_t>(std::max(frameCount, 0)) * 3);
+            std::vector<float> translations(jointCount * 3);
+            std::vector<float> rotations(jointCount * 4);
+            std::vector<uint16_t> scales(jointCount * 3);
+
+            for (int localFrame = 0; localFrame < frameCount; localFrame++) {
+                FbxTime time;
+                time.SetSecondDouble(localFrame / fps + startTime);
+
+                for (size_t j = 0; j < jointCount; j++) {
+                    FbxAMatrix matrix = evaluator->GetNodeLocalTransform(joints[j], time);
+                    FbxVector4 t = matrix.GetT();
+                    FbxQuaternion q = matrix.GetQ();
+                    FbxVector4 s = matrix.GetS();
+                    for (int i = 0; i < 3; i++) {
+                        translations[j * 3 + i] = static_cast<float>(t[i]);
+                        scales[j * 3 + i] = FloatToHalf(static_cast<float>(s[i]));
+                    }
+                    for (int i = 0; i < 4; i++) {
+                        rotations[j * 4 + i] = static_cast<float>(q[i]);
+                    }
+                }
+
+                frames.push_back(Buffer::Of(translations, 3));
+                frames.push_back(Buffer::Of(rotations, 4));
+                frames.push_back(Buffer::Halves(scales, 3));
+            }
+        }
+
+        py::list result;
+        for (size_t i = 0; i + 2 < frames.size(); i += 3) {
+            result.append(py::make_tuple(std::move(frames[i]), std::move(frames[i + 1]), std::move(frames[i + 2])));
+        }
+        return result;
+    }
+
+    // Points, face_vertex_counts, face_vertex_indices, and per face-vertex
+    // normals and uvs (first UV set, named by uv_set) when the mesh has them,
+    // and the vertex color sets; None if the node has no mesh
+    py::object Mesh(const std::string& nodeName) {
+        std::vector<float> points, normals, uvs;
+        std::vector<int32_t> counts, indices;
+        std::string uvSet;
+        std::vector<ColorSet> colorSets;
+        bool found = false;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            FbxNode* node = scene_->FindNodeByName(nodeName.c_str());
+            FbxMesh* mesh = node ? node->GetMesh() : nullptr;
+            if (mesh) {
+                found = true;
+                ExtractMesh(mesh, points, counts, indices, normals, uvs, uvSet);
+                ExtractColorSets(mesh, colorSets);
+            }
+        }
+        if (!found) {
+            return py::none();
+        }
+
+        py::dict result;
+        result["points"] = Buffer::Of(points, 3);
+        result["face_vertex_counts"] = Buffer::Of(counts, 1);
+        result["face_vertex_indices"] = Buffer::Of(indices, 1);
+        result["normals"] = normals.empty() ? py::object(py::none()) : py::cast(Buffer::Of(normals, 3));
+        result["uvs"] = uvs.empty() ? py::object(py::none()) : py::cast(Buffer::Of(uvs, 2));
+        result["uv_set"] = uvSet;
+
+        py::list sets;
+        for (const ColorSet& colorSet : colorSets) {
+            py::dict set;
+            set["name"] = colorSet.name;
+            set["interpolation"] = colorSet.interpolation ? py::object(py::str(colorSet.interpolation)) : py::object(py::none());
+            set["rgb"] = Buffer::Of(colorSet.rgb, 3);
+            set["alpha"] = Buffer::Of(colorSet.alpha, 1);
+            set["rgba"] = Buffer::Of(colorSet.rgba, 4);
+            set["indices"] = colorSet.indexed ? py::object(py::cast(Buffer::Of(colorSet.indices, 1))) : py::object(py::none());
+            set["translucent"] = colorSet.translucent;
+            set["indices_in_range"] = colorSet.indicesInRange;
+            sets.append(set);
+        }
+        result["color_sets"] = sets;
+        return result;
+    }
+
+    // (joint_indices, joint_weights) with max_influences per control point,
+    // like fbx2usd writes them: the largest weights, normalized, padded with
+    // joint 0 at weight 0. Indices refer to joint_names. None without a skin.
+    py::object Skin(const std::string& nodeName, const std::vector<std::string>& jointNames,
+                    int maxInfluences) {
+        std::vector<int32_t> jointIndices;
+        std::vector<float> jointWeights;
+        bool found = false;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            FbxNode* node = scene_->FindNodeByName(nodeName.c_str());
+            FbxMesh* mesh = node ? node->GetMesh() : nullptr;
+            FbxSkin* skin = mesh ? static_cast<FbxSkin*>(mesh->GetDeformer(0, FbxDeformer::eSkin)) : nullptr;
+            if (skin) {
+                found = true;
+                ExtractSkin(mesh, skin, FindNodes(jointNames), maxInfluences, jointIndices, jointWeights);
+            }
+        }
+        if (!found) {
+            return py::none();
+        }
+        return py::make_tuple(Buffer::Of(jointIndices, 1), Buffer::Of(jointWeights, 1));
+    }
+
+    // World-space ((min), (max)) of mesh points and joints, or None
+    py::object Bounds() {
+        double min[3], max[3];
+        bool hasGeometry = false;
+        {
+            py::gil_scoped_release release;
+            std::lock_guard<std::mutex> lock(mutex_);
+            ComputeBoundsRecursive(scene_->GetRootNode(), min, max, hasGeometry);
+        }
+        if (!hasGeometry) {
+            return py::none();
+        }
+        return py::make_tuple(py::make_tuple(min[0], min[1], min[2]),
+                              py::make_tuple(max[0], max[1], max[2]));
+    }
+
+private:
+    // A vertex color set as fbx2usd writes it: the distinct colors, and the
+    // per-element indices into them when the set is indexed. interpolation
+    // is the USD primvar interpolation, or null for mappings USD has none for
+    // (the colors are left empty then). A constant set is reduced to its one
+    // color.
+    struct ColorSet {
+        std::string name;
+        const char* interpolation = nullptr;
+        std::vector<float> rgb, alpha, rgba;
+        std::vector<int32_t> indices;
+        bool indexed = false;
+        bool translucent = false;
+        bool indicesInRange = true;
+    };
+
+    std::vector<FbxNode*> FindNodes(const std::vector<std::string>& names) {
+        std::vector<FbxNode*> nodes;
+        nodes.reserve(names.size());
+        for (const std::string& name : names) {
+            FbxNode* node = scene_->FindNodeByName(name.c_str());
+            if (!node) {
+                throw py::key_error("No node named " + name);
+            }
+            nodes.push_back(node);
+        }
+        return nodes;
+    }
+
+    FbxAnimStack* FindAnimStack(const std::string& name) {
+        int stackCount = scene_->GetSrcObjectCount<FbxAnimStack>();
+        for (int i = 0; i < stackCount; i++) {
+            FbxAnimStack* stack = scene_->GetSrcObject<FbxAnimStack>(i);
+            if (name == stack->GetName()) {
+                return stack;
+            }
+        }
+        throw py::key_error("No animation stack named " + name);
+    }
+
+    static void ExtractMesh(FbxMesh* mesh, std::vector<float>& points, std::vector<int32_t>& counts,
+                            std::vector<int32_t>& indices, std::vector<float>& normals, std::vector<float>& uvs,
+                            std::string& uvSet) {
+        int pointCount = mesh->GetControlPointsCount();
+        FbxVector4* controlPoints = mesh->GetControlPoints();
+        points.resize(static_cast<size_t>(pointCount) * 3);
+        for (int i = 0; i < pointCount; i++) {
+            for (int c = 0; c < 3; c++) {
+                points[i * 3 + c] = static_cast<float>(controlPoints[i][c]);
+            }
+        }
+
+        int polygonCount = mesh->GetPolygonCount();
+        counts.reserve(polygonCount);
+        indices.reserve(mesh->GetPolygonVertexCount());
+        for (int p = 0; p < polygonCount; p++) {
+            int size = mesh->GetPolygonSize(p);
+            counts.push_back(size);
+            for (int v = 0; v < size; v++) {
+                indices.push_back(mesh->GetPolygonVertex(p, v));
+            }
+        }
+
+        bool hasNormals = mesh->GetElementNormalCount() > 0;
+        FbxStringList uvSetNames;
+        mesh->GetUVSetNames(uvSetNames);
+        const char* uvSetName = uvSetNames.GetCount() > 0 ? uvSetNames.GetStringAt(0) : nullptr;
+        if (uvSetName) {
+            uvSet = uvSetName;
+        }
+
+        if (hasNormals) {
+            normals.reserve(indices.size() * 3);
+        }
+        if (uvSetName) {
+            uvs.reserve(indices.size() * 2);
+        }
+        for (int p = 0; p < polygonCount; p++) {
+            int size = mesh->GetPolygonSize(p);
+            for (int v = 0; v < size; v++) {
+                if (hasNormals) {
+                    FbxVector4 normal;
+                    mesh->GetPolygonVertexNormal(p, v, normal);
+                    for (int c = 0; c < 3; c++) {
+                        normals.push_back(static_cast<float>(normal[c]));
+                    }
+                }
+                if (uvSetName) {
+                    FbxVector2 uv;
+                    bool unmapped = false;
+                    mesh->GetPolygonVertexUV(p, v, uvSetName, uv, unmapped);
+                    uvs.push_back(static_cast<float>(uv[0]));
+                    uvs.push_back(static_cast<float>(uv[1]));
+                }
+            }
+        }
+    }
+
+    static const char* ColorInterpolation(FbxLayerElement::EMappingMode mapping) {
+        switch (mapping) {
+        case FbxLayerElement::eByControlPoint:
+            return "vertex";
+        case FbxLayerElement::eByPolygonVertex:
+            return "faceVarying";
+        case FbxLayerElement::eByPolygon:
+            return "uniform";
+        case FbxLayerElement::eAllSame:
+            return "constant";
+        default:
+            return nullptr;
+        }
+    }
+
+    static void ExtractColorSets(FbxMesh* mesh, std::vector<ColorSet>& sets) {
+        int setCount = mesh->GetElementVertexColorCount();
+        sets.resize(setCount);
+        for (int s = 0; s < setCount; s++) {
+            FbxGeometryElementVertexColor* element = mesh->GetElementVertexColor(s);
+            ColorSet& set = sets[s];
+            set.interpolation = element ? ColorInterpolation(element->GetMappingMode()) : nullptr;
+            if (!set.interpolation) {
+                continue;
+            }
+            set.name = element->GetName();
+
+            FbxLayerElementArrayTemplate<FbxColor>& direct = element->GetDirectArray();
+            int first = 0;
+            int colorCount = direct.GetCount();
+            set.indexed = element->GetReferenceMode() != FbxLayerElement::eDirect;
+            if (set.indexed) {
+                FbxLayerElementArrayTemplate<int>& indexArray = element->GetIndexArray();
+                set.indices.reserve(indexArray.GetCount());
+                for (int i = 0; i < indexArray.GetCount(); i++) {
+                    set.indices.push_back(indexArray.GetAt(i));
+                }
+            }
+            if (std::strcmp(set.interpolation, "constant") == 0) {
+                first = set.indexed && !set.indices.empty() ? set.indices[0] : 0;
+                colorCount = first >= 0 && first < colorCount ? 1 : 0;
+                set.indexed = false;
+                set.indices.clear();
+            }
+
+            set.rgb.reserve(static_cast<size_t>(colorCount) * 3);
+            set.alpha.reserve(colorCount);
+            set.rgba.reserve(static_cast<size_t>(colorCount) * 4);
+            for (int i = first; i < first + colorCount; i++) {
+                FbxColor color = direct.GetAt(i);
+                float channels[4] = { static_cast<float>(color.mRed), static_cast<float>(color.mGreen),
+                                      static_cast<float>(color.mBlue), static_cast<float>(color.mAlpha) };
+                set.rgb.insert(set.rgb.end(), channels, channels + 3);
+                set.alpha.push_back(channels[3]);
+                set.rgba.insert(set.rgba.end(), channels, channels + 4);
+                set.translucent = set.translucent || color.mAlpha < 1.0;
+            }
+            for (int32_t index : set.indices) {
+                if (index < 0 || index >= colorCount) {
+                    set.indicesInRange = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    static void ExtractSkin(FbxMesh* mesh, FbxSkin* skin, const std::vector<FbxNode*>& joints, int maxInfluences,
+                            std::vector<int32_t>& jointIndices, std::vector<float>& jointWeights) {
+        int vertexCount = mesh->GetControlPointsCount();
+        std::vector<std::vector<std::pair<int, double>>> vertexWeights(vertexCount);
+
+        for (int c = 0; c < skin->GetClusterCount(); c++) {
+            FbxCluster* cluster = skin->GetCluster(c);
+            std::vector<FbxNode*>::const_iterator joint = std::find(joints.begin(), joints.end(), cluster->GetLink());
+            if (joint == joints.end()) {
+                continue;
+            }
+            int jointIndex = static_cast<int>(joint - joints.begin());
+
+            int* clusterIndices = cluster->GetControlPointIndices();
+            double* clusterWeights = cluster->GetControlPointWeights();
+            for (int i = 0; i < cluster->GetControlPointIndicesCount(); i++) {
+                int vertex = clusterIndices[i];
+                if (vertex >= 0 && vertex < vertexCount && clusterWeights[i] > 0) {
+                    vertexWeights[vertex].push_back(std::make_pair(jointIndex, clusterWeights[i]));
+                }
+            }
+        }
+
+        jointIndices.reserve(static_cast<size_t>(vertexCount) * maxInfluences);
+        jointWeights.reserve(static_cast<size_t>(vertexCount) * maxInfluences);
+        for (std::vector<std::pair<int, double>>& weights : vertexWeights) {
+            // Stable, so equal weights keep cluster order as in fbx2usd
+            std::stable_sort(weights.begin(), weights.end(),
+                             [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+                                 return a.second > b.second;
+                             });
+            if (static_cast<int>(weights.size()) > maxInfluences) {
+                weights.resize(maxInfluences);
+            }
+
+            double total = 0;
+            for (const std::pair<int, double>& weight : weights) {
+                total += weight.second;
+            }
+            for (int i = 0; i < maxInfluences; i++) {
+                if (i < static_cast<int>(weights.size())) {
+                    jointIndices.push_back(weights[i].first);
+                    jointWeights.push_back(static_cast<float>(total > 0 ? weights[i].second / total : weights[i].second));
+                } else {
+                    jointIndices.push_back(0);
+                    jointWeights.push_back(0.0f);
+                }
+            }
+        }
+    }
+
+    static void ComputeBoundsRecursive(FbxNode* node, double* min, double* max, bool& hasGeometry) {
+        FbxNodeAttribute* attr = node->GetNodeAttribute();
+        if (attr) {
+            FbxNodeAttribute::EType type = attr->GetAttributeType();
+            std::vector<FbxVector4> points;
+            if (type == FbxNodeAttribute::eMesh && node->GetMesh()) {
+                FbxMesh* mesh = node->GetMesh();
+                FbxAMatrix globalTransform = node->EvaluateGlobalTransform();
+                FbxVector4* controlPoints = mesh->GetControlPoints();
+                for (int i = 0; i < mesh->GetControlPointsCount(); i++) {
+                    points.push_back(globalTransform.MultT(FbxVector4(controlPoints[i][0], controlPoints[i][1], controlPoints[i][2], 1.0)));
+                }
+            } else if (type == FbxNodeAttribute::eSkeleton) {
+                points.push_back(node->EvaluateGlobalTransform().GetT());
+            }
+
+            for (const FbxVector4& p : points) {
+                for (int i = 0; i < 3; i++) {
+                    if (!hasGeometry || p[i] < min[i]) min[i] = p[i];
+                    if (!hasGeometry || p[i] > max[i]) max[i] = p[i];
+                }
+                hasGeometry = true;
+            }
+        }
+
+        for (int i = 0; i < node->GetChildCount(); i++) {
+            ComputeBoundsRecursive(node->GetChild(i), min, max, hasGeometry);
+        }
+    }
+
+    FbxManager* manager_;
+    FbxScene* scene_;
+    std::mutex mutex_;
+};
+
+PYBIND11_MODULE(fbx2usd_native, m) {
+    m.doc() = "FBX extraction for fbx2usd that releases the GIL";
+
+    py::class_<Buffer>(m, "Buffer", py::buffer_protocol())
+        .def_buffer(&Buffer::Info)
+        .def("__len__", [](const Buffer& buffer) { return buffer.rows; });
+
+    py::class_<Scene>(m, "Scene")
+        .def(py::init<const std::string&>(), py::arg("path"))
+        .def("sample_clip", &Scene::SampleClip,
+             py::arg("joint_names"), py::arg("stack_name"), py::arg("frame_count"), py::arg("fps"))
+        .def("mesh", &Scene::Mesh, py::arg("node_name"))
+        .def("skin", &Scene::Skin, py::arg("node_name"), py::arg("joint_names"), py::arg("max_influences") = 4)
+        .def("bounds", &Scene::Bounds);
+}
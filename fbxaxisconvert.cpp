@@ -5,13 +5,14 @@
  * using DeepConvertScene (or ConvertScene with --shallow).
  *
  * Usage:
- *   fbxaxisconvert <input.fbx> <output.fbx> [--target <system>] [--shallow]
+ *   fbxaxisconvert <input.fbx> <output.fbx> [--target <system>] [--shallow] [--trace <trace.json>]
  *
  * Build:
  *   make
  */
 
-#include "fbxsdk_fix.h"
+#include "fbxscene_io.h"
+#include "tracer.h"
 #include <cstdio>
 #include <cstring>
 
@@ -140,6 +141,7 @@ void PrintUsage(const char* programName) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -t, --target <system>  Target coordinate system (default: maya-y-up)\n");
     fprintf(stderr, "  --shallow              Use ConvertScene instead of DeepConvertScene\n");
+    fprintf(stderr, "  --trace <file>         Write a Chrome trace-event JSON file of the conversion phases\n");
     fprintf(stderr, "  -h, --help             Show this help message\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "Target coordinate systems:\n");
@@ -165,11 +167,23 @@ const FbxAxisSystem* FindAxisSystem(const char* name) {
     return nullptr;
 }
 
+// Writes the trace file when main returns, including on errors
+struct TraceFileWriter {
+    const char* path;
+
+    ~TraceFileWriter() {
+        if (path && !Tracer::Instance().Write(path)) {
+            fprintf(stderr, "Warning: Failed to write trace: %s\n", path);
+        }
+    }
+};
+
 int main(int argc, char** argv) {
     // Parse arguments
     const char* inputPath = nullptr;
     const char* outputPath = nullptr;
     const char* targetName = "maya-y-up";
+    const char* tracePath = nullptr;
     bool useShallow = false;
 
     for (int i = 1; i < argc; i++) {
@@ -182,6 +196,13 @@ int main(int argc, char** argv) {
                 fprintf(stderr, "Error: --target requires an argument\n");
                 return 1;
             }
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 < argc) {
+                tracePath = argv[++i];
+            } else {
+                fprintf(stderr, "Error: --trace requires an argument\n");
+                return 1;
+            }
         } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
             PrintUsage(argv[0]);
             return 0;
@@ -209,42 +230,28 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (tracePath) {
+        Tracer::Instance().Enable("fbxaxisconvert");
+    }
+    TraceFileWriter traceWriter = { tracePath };
+
     // Initialize the FBX SDK
-    FbxManager* manager = FbxManager::Create();
+    FbxManager* manager = CreateFbxManager();
     if (!manager) {
-        fprintf(stderr, "Error: Failed to create FBX Manager\n");
         return 1;
     }
 
-    // Create IO settings
-    FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
-    manager->SetIOSettings(ios);
-
-    // Create importer
-    FbxImporter* importer = FbxImporter::Create(manager, "");
-
-    fprintf(stderr, "Loading: %s\n", inputPath);
-
-    if (!importer->Initialize(inputPath, -1, manager->GetIOSettings())) {
-        fprintf(stderr, "Error: Failed to initialize importer: %s\n",
-                importer->GetStatus().GetErrorString());
-        manager->Destroy();
-        return 1;
+    FbxScene* scene = nullptr;
+    {
+        TraceSpan span("FBX import", TraceArg("file", inputPath));
+        fprintf(stderr, "Loading: %s\n", inputPath);
+        scene = LoadFbxScene(manager, inputPath);
     }
-
-    // Create scene and import
-    FbxScene* scene = FbxScene::Create(manager, "");
-
-    if (!importer->Import(scene)) {
-        fprintf(stderr, "Error: Failed to import scene: %s\n",
-                importer->GetStatus().GetErrorString());
-        importer->Destroy();
+    if (!scene) {
         manager->Destroy();
         return 1;
     }
 
-    importer->Destroy();
-
     // Get current axis system
     FbxAxisSystem currentAxisSystem = scene->GetGlobalSettings().GetAxisSystem();
 
@@ -260,9 +267,11 @@ int main(int argc, char** argv) {
 
         if (useShallow) {
             fprintf(stderr, "Converting with ConvertScene (shallow)...\n");
+            TraceSpan span("ConvertScene", TraceArg("target", targetName));
             targetAxisSystem->ConvertScene(scene);
         } else {
             fprintf(stderr, "Converting with DeepConvertScene...\n");
+            TraceSpan span("DeepConvertScene", TraceArg("target", targetName));
             targetAxisSystem->DeepConvertScene(scene);
         }
 
@@ -272,48 +281,18 @@ int main(int argc, char** argv) {
         PrintAxisSystemDetails(newAxisSystem);
     }
 
-    // Create exporter
-    FbxExporter* exporter = FbxExporter::Create(manager, "");
-
-    // Find binary FBX format
-    int fileFormat = -1;
-    int formatCount = manager->GetIOPluginRegistry()->GetWriterFormatCount();
-
-    for (int i = 0; i < formatCount; i++) {
-        if (manager->GetIOPluginRegistry()->WriterIsFBX(i)) {
-            FbxString desc = manager->GetIOPluginRegistry()->GetWriterFormatDescription(i);
-            if (desc.Find("binary") >= 0) {
-                fileFormat = i;
-                break;
-            }
-        }
-    }
-
-    if (fileFormat < 0) {
-        fileFormat = manager->GetIOPluginRegistry()->GetNativeWriterFormat();
-    }
-
     fprintf(stderr, "Saving: %s\n", outputPath);
 
-    if (!exporter->Initialize(outputPath, fileFormat, manager->GetIOSettings())) {
-        fprintf(stderr, "Error: Failed to initialize exporter: %s\n",
-                exporter->GetStatus().GetErrorString());
-        exporter->Destroy();
-        manager->Destroy();
-        return 1;
+    bool saved;
+    {
+        TraceSpan span("FBX export", TraceArg("file", outputPath));
+        saved = SaveFbxScene(manager, scene, outputPath);
     }
-
-    if (!exporter->Export(scene)) {
-        fprintf(stderr, "Error: Failed to export scene: %s\n",
-                exporter->GetStatus().GetErrorString());
-        exporter->Destroy();
-        manager->Destroy();
+    manager->Destroy();
+    if (!saved) {
         return 1;
     }
 
-    exporter->Destroy();
-    manager->Destroy();
-
     fprintf(stderr, "Done!\n");
     return 0;
 }
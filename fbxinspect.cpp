@@ -0,0 +1,757 @@
+/**
+ * fbxinspect-native - FBX file inspection tool
+ *
+ * Native counterpart of fbxinspect for library-wide audits: the same
+ * Markdown (or --json) report of scene info, node hierarchy, skeletons,
+ * meshes, animation takes, materials and bounds, without starting Python
+ * and the FBX Python bindings for every file.
+ *
+ * Usage:
+ *   fbxinspect-native <input.fbx> [-v] [--json] [-m]
+ *
+ * Build:
+ *   make
+ */
+
+#include "fbxscene_io.h"
+#include "inspect_report.h"
+#include <utility>
+
+// ---------------------------------------------------------------------------
+// JSON output
+// ---------------------------------------------------------------------------
+
+// A JSON document, written like Python's json.dumps(indent=2, ensure_ascii=False)
+struct Json {
+    enum Type { eNull, eBool, eInt, eFloat, eString, eArray, eObject };
+
+    Type type;
+    bool boolValue;
+    long long intValue;
+    double floatValue;
+    std::string stringValue;
+    std::vector<Json> items;
+    std::vector<std::pair<std::string, Json> > fields;
+
+    Json() : type(eNull), boolValue(false), intValue(0), floatValue(0) {}
+
+    static Json Bool(bool value) { Json json; json.type = eBool; json.boolValue = value; return json; }
+    static Json Integer(long long value) { Json json; json.type = eInt; json.intValue = value; return json; }
+    static Json Float(double value) { Json json; json.type = eFloat; json.floatValue = value; return json; }
+    static Json String(const std::string& value) { Json json; json.type = eString; json.stringValue = value; return json; }
+    static Json Array() { Json json; json.type = eArray; return json; }
+    static Json Object() { Json json; json.type = eObject; return json; }
+
+    Json& Set(const char* key, const Json& value) {
+        fields.push_back(std::make_pair(std::string(key), value));
+        return *this;
+    }
+
+    Json& Push(const Json& value) {
+        items.push_back(value);
+        return *this;
+    }
+
+    static void WriteString(std::string& out, const std::string& value) {
+        out += '"';
+        for (size_t i = 0; i < value.size(); i++) {
+            unsigned char c = value[i];
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                case '\b': out += "\\b"; break;
+                case '\f': out += "\\f"; break;
+                default:
+                    if (c < 0x20) {
+                        Appendf(out, "\\u%04x", c);
+                    } else {
+                        out += (char)c;
+                    }
+            }
+        }
+        out += '"';
+    }
+
+    void Write(std::string& out, int depth = 0) const {
+        std::string indent((depth + 1) * 2, ' ');
+        std::string closing(depth * 2, ' ');
+        switch (type) {
+            case eNull: out += "null"; break;
+            case eBool: out += boolValue ? "true" : "false"; break;
+            case eInt: out += Int(intValue); break;
+            case eFloat: out += PyFloat(floatValue); break;
+            case eString: WriteString(out, stringValue); break;
+            case eArray:
+                if (items.empty()) {
+                    out += "[]";
+                    break;
+                }
+                out += "[\n";
+                for (size_t i = 0; i < items.size(); i++) {
+                    out += indent;
+                    items[i].Write(out, depth + 1);
+                    out += i + 1 < items.size() ? ",\n" : "\n";
+                }
+                out += closing + "]";
+                break;
+            case eObject:
+                if (fields.empty()) {
+                    out += "{}";
+                    break;
+                }
+                out += "{\n";
+                for (size_t i = 0; i < fields.size(); i++) {
+                    out += indent;
+                    WriteString(out, fields[i].first);
+                    out += ": ";
+                    fields[i].second.Write(out, depth + 1);
+                    out += i + 1 < fields.size() ? ",\n" : "\n";
+                }
+                out += closing + "}";
+                break;
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Scene queries, mirroring the functions of the same names in fbxinspect
+// ---------------------------------------------------------------------------
+
+struct SceneInfo {
+    double fps;
+    const char* upAxis;
+    const char* coordSystem;
+    double unitScale;
+    std::string unitName;
+    std::string title;
+    std::string author;
+    std::string comment;
+};
+
+SceneInfo GetSceneInfo(FbxScene* scene) {
+    SceneInfo info;
+    FbxGlobalSettings& globalSettings = scene->GetGlobalSettings();
+
+    info.fps = FbxTime::GetFrameRate(globalSettings.GetTimeMode());
+
+    FbxAxisSystem axisSystem = globalSettings.GetAxisSystem();
+    int upSign = 0;
+    FbxAxisSystem::EUpVector upVector = axisSystem.GetUpVector(upSign);
+    if (axisSystem == FbxAxisSystem::MayaYUp || axisSystem == FbxAxisSystem::OpenGL) {
+        info.upAxis = "Y";
+    } else if (axisSystem == FbxAxisSystem::MayaZUp || axisSystem == FbxAxisSystem::Max) {
+        info.upAxis = "Z";
+    } else {
+        info.upAxis = upVector == FbxAxisSystem::eZAxis ? "Z" : "Y";
+    }
+
+    info.coordSystem = axisSystem.GetCoorSystem() == FbxAxisSystem::eRightHanded ? "Right-Handed" : "Left-Handed";
+
+    FbxSystemUnit systemUnit = globalSettings.GetSystemUnit();
+    info.unitScale = systemUnit.GetScaleFactor();
+    info.unitName = systemUnit.GetScaleFactorAsString().Buffer();
+
+    FbxDocumentInfo* sceneInfo = scene->GetSceneInfo();
+    if (sceneInfo) {
+        info.title = sceneInfo->mTitle.Buffer();
+        info.author = sceneInfo->mAuthor.Buffer();
+        info.comment = sceneInfo->mComment.Buffer();
+    }
+    return info;
+}
+
+struct NodeCounts {
+    int total, meshes, skeletons, cameras, lights, nulls, materials, textures;
+};
+
+void CountNodesRecursive(FbxNode* node, NodeCounts& counts) {
+    counts.total++;
+
+    FbxNodeAttribute* attr = node->GetNodeAttribute();
+    if (attr) {
+        switch (attr->GetAttributeType()) {
+            case FbxNodeAttribute::eMesh: counts.meshes++; break;
+            case FbxNodeAttribute::eSkeleton: counts.skeletons++; break;
+            case FbxNodeAttribute::eCamera: counts.cameras++; break;
+            case FbxNodeAttribute::eLight: counts.lights++; break;
+            case FbxNodeAttribute::eNull: counts.nulls++; break;
+            default: break;
+        }
+    }
+
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        CountNodesRecursive(node->GetChild(i), counts);
+    }
+}
+
+NodeCounts CountNodes(FbxScene* scene) {
+    NodeCounts counts;
+    memset(&counts, 0, sizeof(counts));
+    CountNodesRecursive(scene->GetRootNode(), counts);
+    counts.materials = scene->GetMaterialCount();
+    counts.textures = scene->GetTextureCount();
+    return counts;
+}
+
+const char* GetNodeTypeName(FbxNode* node) {
+    FbxNodeAttribute* attr = node->GetNodeAttribute();
+    if (!attr) {
+        return "Null";
+    }
+
+    switch (attr->GetAttributeType()) {
+        case FbxNodeAttribute::eUnknown: return "Unknown";
+        case FbxNodeAttribute::eNull: return "Null";
+        case FbxNodeAttribute::eMarker: return "Marker";
+        case FbxNodeAttribute::eSkeleton: return "Skeleton";
+        case FbxNodeAttribute::eMesh: return "Mesh";
+        case FbxNodeAttribute::eNurbs: return "Nurbs";
+        case FbxNodeAttribute::ePatch: return "Patch";
+        case FbxNodeAttribute::eCamera: return "Camera";
+        case FbxNodeAttribute::eCameraStereo: return "CameraStereo";
+        case FbxNodeAttribute::eCameraSwitcher: return "CameraSwitcher";
+        case FbxNodeAttribute::eLight: return "Light";
+        case FbxNodeAttribute::eOpticalReference: return "OpticalReference";
+        case FbxNodeAttribute::eOpticalMarker: return "OpticalMarker";
+        case FbxNodeAttribute::eNurbsCurve: return "NurbsCurve";
+        case FbxNodeAttribute::eTrimNurbsSurface: return "TrimNurbsSurface";
+        case FbxNodeAttribute::eBoundary: return "Boundary";
+        case FbxNodeAttribute::eNurbsSurface: return "NurbsSurface";
+        case FbxNodeAttribute::eShape: return "Shape";
+        case FbxNodeAttribute::eLODGroup: return "LODGroup";
+        case FbxNodeAttribute::eSubDiv: return "SubDiv";
+        default: return "Unknown";
+    }
+}
+
+bool IsSkeleton(FbxNode* node) {
+    FbxNodeAttribute* attr = node->GetNodeAttribute();
+    return attr && attr->GetAttributeType() == FbxNodeAttribute::eSkeleton;
+}
+
+// Node and joint trees: {"name", "type" or "path", "children"}
+Json BuildNodeTree(FbxNode* node) {
+    Json tree = Json::Object();
+    tree.Set("name", Json::String(node->GetName()));
+    tree.Set("type", Json::String(GetNodeTypeName(node)));
+    Json children = Json::Array();
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        children.Push(BuildNodeTree(node->GetChild(i)));
+    }
+    tree.Set("children", children);
+    return tree;
+}
+
+void CollectJoints(FbxNode* node, int& jointCount, Json& treeList, const std::string& pathPrefix) {
+    if (!IsSkeleton(node)) {
+        return;
+    }
+
+    std::string jointName = node->GetName();
+    std::string jointPath = pathPrefix.empty() ? jointName : pathPrefix + "/" + jointName;
+    jointCount++;
+
+    Json tree = Json::Object();
+    tree.Set("name", Json::String(jointName));
+    tree.Set("path", Json::String(jointPath));
+    Json children = Json::Array();
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        CollectJoints(node->GetChild(i), jointCount, children, jointPath);
+    }
+    tree.Set("children", children);
+    treeList.Push(tree);
+}
+
+// Skeletons: {"name", "joint_count", "joints": joint tree}
+void FindSkeletonNodes(FbxNode* node, Json& skeletons) {
+    if (IsSkeleton(node)) {
+        int jointCount = 0;
+        Json joints = Json::Array();
+        CollectJoints(node, jointCount, joints, "");
+        Json skeleton = Json::Object();
+        skeleton.Set("name", Json::String(node->GetName()));
+        skeleton.Set("joint_count", Json::Integer(jointCount));
+        skeleton.Set("joints", joints);
+        skeletons.Push(skeleton);
+        return;
+    }
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        FindSkeletonNodes(node->GetChild(i), skeletons);
+    }
+}
+
+Json GetAnimationStacks(FbxScene* scene) {
+    Json animations = Json::Array();
+    double fps = FbxTime::GetFrameRate(FbxTime::GetGlobalTimeMode());
+
+    int stackCount = scene->GetSrcObjectCount<FbxAnimStack>();
+    for (int i = 0; i < stackCount; i++) {
+        FbxAnimStack* stack = scene->GetSrcObject<FbxAnimStack>(i);
+        if (!stack) {
+            continue;
+        }
+
+        FbxTimeSpan timeSpan = stack->GetLocalTimeSpan();
+        FbxTime startTime = timeSpan.GetStart();
+        FbxTime stopTime = timeSpan.GetStop();
+        double startSeconds = startTime.GetSecondDouble();
+        double stopSeconds = stopTime.GetSecondDouble();
+        long long startFrame = startTime.GetFrameCount();
+        long long stopFrame = stopTime.GetFrameCount();
+
+        Json anim = Json::Object();
+        anim.Set("name", Json::String(stack->GetName()));
+        anim.Set("duration", Json::Float(stopSeconds - startSeconds));
+        anim.Set("start_time", Json::Float(startSeconds));
+        anim.Set("end_time", Json::Float(stopSeconds));
+        anim.Set("start_frame", Json::Integer(startFrame));
+        anim.Set("end_frame", Json::Integer(stopFrame));
+        anim.Set("frame_count", Json::Integer(stopFrame - startFrame + 1));
+        anim.Set("fps", Json::Float(fps));
+        anim.Set("layer_count", Json::Integer(stack->GetMemberCount<FbxAnimLayer>()));
+        animations.Push(anim);
+    }
+    return animations;
+}
+
+void FindMeshes(FbxNode* node, Json& meshes) {
+    FbxNodeAttribute* attr = node->GetNodeAttribute();
+    if (attr && attr->GetAttributeType() == FbxNodeAttribute::eMesh) {
+        FbxMesh* mesh = node->GetMesh();
+        if (mesh) {
+            Json info = Json::Object();
+            info.Set("name", Json::String(node->GetName()));
+            info.Set("vertices", Json::Integer(mesh->GetControlPointsCount()));
+            info.Set("polygons", Json::Integer(mesh->GetPolygonCount()));
+            info.Set("uv_sets", Json::Integer(mesh->GetElementUVCount()));
+            info.Set("materials", Json::Integer(node->GetMaterialCount()));
+
+            FbxSkin* skin = mesh->GetDeformerCount(FbxDeformer::eSkin) > 0
+                ? static_cast<FbxSkin*>(mesh->GetDeformer(0, FbxDeformer::eSkin)) : nullptr;
+            info.Set("skinned", Json::Bool(skin != nullptr));
+            info.Set("cluster_count", Json::Integer(skin ? skin->GetClusterCount() : 0));
+            info.Set("blend_shapes", Json::Integer(mesh->GetDeformerCount(FbxDeformer::eBlendShape)));
+            meshes.Push(info);
+        }
+    }
+
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        FindMeshes(node->GetChild(i), meshes);
+    }
+}
+
+Json GetMaterialInfo(FbxScene* scene) {
+    static const char* const textureProperties[][2] = {
+        { FbxSurfaceMaterial::sDiffuse, "Diffuse" },
+        { FbxSurfaceMaterial::sNormalMap, "Normal" },
+        { FbxSurfaceMaterial::sSpecular, "Specular" },
+        { FbxSurfaceMaterial::sEmissive, "Emissive" },
+        { FbxSurfaceMaterial::sBump, "Bump" },
+    };
+
+    Json materials = Json::Array();
+    for (int i = 0; i < scene->GetMaterialCount(); i++) {
+        FbxSurfaceMaterial* material = scene->GetMaterial(i);
+        if (!material) {
+            continue;
+        }
+
+        const char* shadingModel = "Unknown";
+        if (FbxCast<FbxSurfacePhong>(material)) {
+            shadingModel = "Phong";
+        } else if (FbxCast<FbxSurfaceLambert>(material)) {
+            shadingModel = "Lambert";
+        }
+
+        Json textures = Json::Array();
+        for (size_t p = 0; p < sizeof(textureProperties) / sizeof(textureProperties[0]); p++) {
+            FbxProperty prop = material->FindProperty(textureProperties[p][0]);
+            if (!prop.IsValid()) {
+                continue;
+            }
+            for (int j = 0; j < prop.GetSrcObjectCount(); j++) {
+                FbxFileTexture* texture = FbxCast<FbxFileTexture>(prop.GetSrcObject(j));
+                if (texture) {
+                    Json entry = Json::Object();
+                    entry.Set("type", Json::String(textureProperties[p][1]));
+                    entry.Set("filename", Json::String(Basename(texture->GetFileName())));
+                    textures.Push(entry);
+                }
+            }
+        }
+
+        Json info = Json::Object();
+        info.Set("name", Json::String(material->GetName()));
+        info.Set("shading_model", Json::String(shadingModel));
+        info.Set("textures", textures);
+        materials.Push(info);
+    }
+    return materials;
+}
+
+struct Bounds {
+    bool hasGeometry;
+    double min[3];
+    double max[3];
+
+    void Update(double x, double y, double z) {
+        double point[3] = { x, y, z };
+        for (int i = 0; i < 3; i++) {
+            if (!hasGeometry || point[i] < min[i]) min[i] = point[i];
+            if (!hasGeometry || point[i] > max[i]) max[i] = point[i];
+        }
+        hasGeometry = true;
+    }
+};
+
+void ComputeBoundsRecursive(FbxNode* node, Bounds& bounds) {
+    FbxNodeAttribute* attr = node->GetNodeAttribute();
+    if (attr) {
+        FbxNodeAttribute::EType type = attr->GetAttributeType();
+        if (type == FbxNodeAttribute::eMesh) {
+            FbxMesh* mesh = node->GetMesh();
+            if (mesh) {
+                FbxAMatrix globalTransform = node->EvaluateGlobalTransform();
+                FbxVector4* points = mesh->GetControlPoints();
+                int count = mesh->GetControlPointsCount();
+                for (int i = 0; i < count; i++) {
+                    FbxVector4 p = globalTransform.MultT(FbxVector4(points[i][0], points[i][1], points[i][2], 1.0));
+                    bounds.Update(p[0], p[1], p[2]);
+                }
+            }
+        } else if (type == FbxNodeAttribute::eSkeleton) {
+            FbxVector4 t = node->EvaluateGlobalTransform().GetT();
+            bounds.Update(t[0], t[1], t[2]);
+        }
+    }
+
+    for (int i = 0; i < node->GetChildCount(); i++) {
+        ComputeBoundsRecursive(node->GetChild(i), bounds);
+    }
+}
+
+// {"min", "max", "center", "size"} or null
+Json ComputeSceneBoundingBox(FbxScene* scene) {
+    Bounds bounds;
+    bounds.hasGeometry = false;
+    ComputeBoundsRecursive(scene->GetRootNode(), bounds);
+    if (!bounds.hasGeometry) {
+        return Json();
+    }
+
+    Json minJson = Json::Array(), maxJson = Json::Array(), centerJson = Json::Array(), sizeJson = Json::Array();
+    for (int i = 0; i < 3; i++) {
+        minJson.Push(Json::Float(bounds.min[i]));
+        maxJson.Push(Json::Float(bounds.max[i]));
+        centerJson.Push(Json::Float((bounds.min[i] + bounds.max[i]) / 2));
+        sizeJson.Push(Json::Float(bounds.max[i] - bounds.min[i]));
+    }
+    Json bbox = Json::Object();
+    bbox.Set("min", minJson);
+    bbox.Set("max", maxJson);
+    bbox.Set("center", centerJson);
+    bbox.Set("size", sizeJson);
+    return bbox;
+}
+
+// ---------------------------------------------------------------------------
+// Markdown output
+// ---------------------------------------------------------------------------
+
+void PrintTree(std::string& out, const Json& tree, const std::string& prefix, bool isRoot, bool showType) {
+    for (size_t i = 0; i < tree.items.size(); i++) {
+        const Json& node = tree.items[i];
+        bool isLast = i + 1 == tree.items.size();
+        std::string connector = isRoot ? "" : (isLast ? "└── " : "├── ");
+        std::string childPrefix = isRoot ? "" : (isLast ? "    " : "│   ");
+
+        out += prefix + connector + node.fields[0].second.stringValue;
+        if (showType) {
+            out += " (" + node.fields[1].second.stringValue + ")";
+        }
+        out += "\n";
+
+        const Json& children = node.fields[2].second;
+        if (!children.items.empty()) {
+            PrintTree(out, children, prefix + childPrefix, false, showType);
+        }
+    }
+}
+
+std::string PointString(const Json& point) {
+    return "(" + Fixed(point.items[0].floatValue, 2) + ", " + Fixed(point.items[1].floatValue, 2) + ", " +
+           Fixed(point.items[2].floatValue, 2) + ")";
+}
+
+void PrintDefaultOutput(std::string& out, const char* filepath, const Json& record, bool verbose) {
+    const Json& info = record.fields[1].second;
+    const Json& counts = record.fields[2].second;
+    const Json& bbox = record.fields[3].second;
+    const Json& nodes = record.fields[4].second;
+    const Json& skeletons = record.fields[5].second;
+    const Json& meshes = record.fields[6].second;
+    const Json& animations = record.fields[7].second;
+    const Json& materials = record.fields[8].second;
+
+    Appendf(out, "# %s\n\n", Basename(filepath).c_str());
+
+    // Scene info
+    out += "## Scene Info\n\n";
+    std::vector<Row> sceneRows;
+    sceneRows.push_back(Row{"FPS", PyFloat(info.fields[0].second.floatValue)});
+    sceneRows.push_back(Row{"Up Axis", info.fields[1].second.stringValue});
+    sceneRows.push_back(Row{"Coordinate System", info.fields[2].second.stringValue});
+    sceneRows.push_back(Row{"Unit Scale", PyFloat(info.fields[3].second.floatValue) + " (" + info.fields[4].second.stringValue + ")"});
+    if (!info.fields[5].second.stringValue.empty()) {
+        sceneRows.push_back(Row{"Title", info.fields[5].second.stringValue});
+    }
+    if (!info.fields[6].second.stringValue.empty()) {
+        sceneRows.push_back(Row{"Author", info.fields[6].second.stringValue});
+    }
+    PrintMarkdownTable(out, Row{"Property", "Value"}, sceneRows);
+    out += "\n";
+
+    // Node summary
+    out += "## Node Summary\n\n";
+    std::vector<Row> nodeRows;
+    nodeRows.push_back(Row{"Total nodes", Int(counts.fields[0].second.intValue)});
+    static const struct { size_t field; const char* label; bool verboseOnly; } summary[] = {
+        { 1, "Meshes", false }, { 2, "Skeleton bones", false }, { 6, "Materials", false },
+        { 7, "Textures", false }, { 3, "Cameras", true }, { 4, "Lights", true },
+    };
+    for (size_t i = 0; i < sizeof(summary) / sizeof(summary[0]); i++) {
+        long long count = counts.fields[summary[i].field].second.intValue;
+        if (count > 0 && (verbose || !summary[i].verboseOnly)) {
+            nodeRows.push_back(Row{summary[i].label, Int(count)});
+        }
+    }
+    PrintMarkdownTable(out, Row{"Type", "Count"}, nodeRows);
+    out += "\n";
+
+    // Bounding box
+    if (bbox.type == Json::eObject) {
+        out += "## Bounding Box\n\n";
+        const Json& size = bbox.fields[3].second;
+        std::vector<Row> bboxRows;
+        bboxRows.push_back(Row{"Min", PointString(bbox.fields[0].second)});
+        bboxRows.push_back(Row{"Center", PointString(bbox.fields[2].second)});
+        bboxRows.push_back(Row{"Max", PointString(bbox.fields[1].second)});
+        bboxRows.push_back(Row{"Size", Fixed(size.items[0].floatValue, 2) + " x " + Fixed(size.items[1].floatValue, 2) + " x " +
+                                       Fixed(size.items[2].floatValue, 2) + " " + info.fields[4].second.stringValue});
+        PrintMarkdownTable(out, Row{"Property", "Value"}, bboxRows);
+        out += "\n";
+    }
+
+    // Node hierarchy
+    out += "## Node Hierarchy\n\n```\n";
+    PrintTree(out, nodes, "", true, true);
+    out += "```\n\n";
+
+    // Skeleton hierarchy
+    for (size_t i = 0; i < skeletons.items.size(); i++) {
+        const Json& skeleton = skeletons.items[i];
+        Appendf(out, "## Skeleton Hierarchy (%lld joints)\n\n", skeleton.fields[1].second.intValue);
+        out += "**Root:** `" + skeleton.fields[0].second.stringValue + "`\n\n";
+        if (!skeleton.fields[2].second.items.empty()) {
+            out += "```\n";
+            PrintTree(out, skeleton.fields[2].second, "", true, false);
+            out += "```\n\n";
+        }
+    }
+
+    // Mesh info
+    if (!meshes.items.empty()) {
+        out += "## Meshes\n\n";
+        std::vector<Row> meshRows;
+        for (size_t i = 0; i < meshes.items.size(); i++) {
+            const Json& mesh = meshes.items[i];
+            long long blendShapes = mesh.fields[7].second.intValue;
+            meshRows.push_back(Row{
+                mesh.fields[0].second.stringValue,
+                Int(mesh.fields[1].second.intValue),
+                Int(mesh.fields[2].second.intValue),
+                Int(mesh.fields[3].second.intValue),
+                mesh.fields[5].second.boolValue ? "Yes" : "No",
+                blendShapes > 0 ? Int(blendShapes) : "-",
+            });
+        }
+        PrintMarkdownTable(out, Row{"Name", "Vertices", "Polygons", "UV Sets", "Skinned", "Blend Shapes"}, meshRows);
+        out += "\n";
+    }
+
+    // Animation stacks
+    if (!animations.items.empty()) {
+        out += "## Animation Takes\n\n";
+        std::vector<Row> animRows;
+        for (size_t i = 0; i < animations.items.size(); i++) {
+            const Json& anim = animations.items[i];
+            double duration = anim.fields[1].second.floatValue;
+            long long frameCount = anim.fields[6].second.intValue;
+            double fps = anim.fields[7].second.floatValue;
+            animRows.push_back(Row{
+                anim.fields[0].second.stringValue,
+                duration > 0 ? Fixed(duration, 2) + "s" : "-",
+                frameCount > 0 ? Int(frameCount) : "-",
+                fps > 0 ? PyFloat(fps) : "-",
+                Int(anim.fields[8].second.intValue),
+            });
+        }
+        PrintMarkdownTable(out, Row{"Name", "Duration", "Frames", "FPS", "Layers"}, animRows);
+        out += "\n";
+    }
+
+    // Materials
+    if (!materials.items.empty() && verbose) {
+        out += "## Materials\n\n";
+        for (size_t i = 0; i < materials.items.size(); i++) {
+            const Json& material = materials.items[i];
+            out += "### " + material.fields[0].second.stringValue + "\n\n";
+            out += "**Shading Model:** " + material.fields[1].second.stringValue + "\n\n";
+            const Json& textures = material.fields[2].second;
+            if (!textures.items.empty()) {
+                out += "**Textures:**\n\n";
+                for (size_t t = 0; t < textures.items.size(); t++) {
+                    out += "- " + textures.items[t].fields[0].second.stringValue + ": `" +
+                           textures.items[t].fields[1].second.stringValue + "`\n";
+                }
+                out += "\n";
+            }
+        }
+    }
+
+    if (animations.items.empty() && skeletons.items.empty()) {
+        out += "*No animations or skeleton found.*\n\n";
+    }
+}
+
+// The same document as fbxinspect --json; the Markdown is printed from it
+Json BuildRecord(const char* filepath, FbxScene* scene) {
+    SceneInfo info = GetSceneInfo(scene);
+    Json sceneJson = Json::Object();
+    sceneJson.Set("fps", Json::Float(info.fps));
+    sceneJson.Set("up_axis", Json::String(info.upAxis));
+    sceneJson.Set("coord_system", Json::String(info.coordSystem));
+    sceneJson.Set("unit_scale", Json::Float(info.unitScale));
+    sceneJson.Set("unit_name", Json::String(info.unitName));
+    sceneJson.Set("title", Json::String(info.title));
+    sceneJson.Set("author", Json::String(info.author));
+    sceneJson.Set("comment", Json::String(info.comment));
+
+    NodeCounts counts = CountNodes(scene);
+    Json countsJson = Json::Object();
+    countsJson.Set("total", Json::Integer(counts.total));
+    countsJson.Set("meshes", Json::Integer(counts.meshes));
+    countsJson.Set("skeletons", Json::Integer(counts.skeletons));
+    countsJson.Set("cameras", Json::Integer(counts.cameras));
+    countsJson.Set("lights", Json::Integer(counts.lights));
+    countsJson.Set("nulls", Json::Integer(counts.nulls));
+    countsJson.Set("materials", Json::Integer(counts.materials));
+    countsJson.Set("textures", Json::Integer(counts.textures));
+
+    FbxNode* root = scene->GetRootNode();
+    Json nodes = Json::Array();
+    Json skeletons = Json::Array();
+    for (int i = 0; i < root->GetChildCount(); i++) {
+        nodes.Push(BuildNodeTree(root->GetChild(i)));
+        FindSkeletonNodes(root->GetChild(i), skeletons);
+    }
+
+    Json meshes = Json::Array();
+    FindMeshes(root, meshes);
+
+    Json record = Json::Object();
+    record.Set("file", Json::String(Basename(filepath)));
+    record.Set("scene", sceneJson);
+    record.Set("counts", countsJson);
+    record.Set("bounds", ComputeSceneBoundingBox(scene));
+    record.Set("nodes", nodes);
+    record.Set("skeletons", skeletons);
+    record.Set("meshes", meshes);
+    record.Set("animations", GetAnimationStacks(scene));
+    record.Set("materials", GetMaterialInfo(scene));
+    return record;
+}
+
+void PrintUsage(const char* programName) {
+    fprintf(stderr, "Usage: %s <input.fbx> [options]\n", programName);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Inspect FBX files for scene hierarchy, skeletons, and animations.\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -v, --verbose          Show detailed information (materials, etc.)\n");
+    fprintf(stderr, "  -m, --marked           Copy output to pasteboard and open in Marked 2\n");
+    fprintf(stderr, "  --json                 Print the scene information as JSON instead of Markdown\n");
+    fprintf(stderr, "  -h, --help             Show this help message\n");
+}
+
+int main(int argc, char** argv) {
+    const char* inputPath = nullptr;
+    bool verbose = false;
+    bool marked = false;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "-m") == 0 || strcmp(argv[i], "--marked") == 0) {
+            marked = true;
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Error: Unknown option: %s\n", argv[i]);
+            PrintUsage(argv[0]);
+            return 1;
+        } else if (!inputPath) {
+            inputPath = argv[i];
+        }
+    }
+
+    if (!inputPath) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    FILE* file = fopen(inputPath, "rb");
+    if (!file) {
+        fprintf(stderr, "Error: File not found: %s\n", inputPath);
+        return 1;
+    }
+    fclose(file);
+
+    FbxManager* manager = CreateFbxManager();
+    if (!manager) {
+        return 1;
+    }
+
+    FbxScene* scene = LoadFbxScene(manager, inputPath);
+    if (!scene) {
+        manager->Destroy();
+        return 1;
+    }
+
+    Json record = BuildRecord(inputPath, scene);
+    manager->Destroy();
+
+    std::string out;
+    if (json) {
+        record.Write(out);
+        out += "\n";
+    } else {
+        PrintDefaultOutput(out, inputPath, record, verbose);
+    }
+
+    if (marked && !json) {
+        if (!OpenInMarked(out)) {
+            return 1;
+        }
+    } else {
+        fwrite(out.data(), 1, out.size(), stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,341 @@
+/**
+ * fbxscale-native - Scale FBX geometry, transforms and animation
+ *
+ * Native counterpart of fbxscale for very large scenes. Instead of converting
+ * to a temporary unit and back, it scales everything that carries a length
+ * directly, in bulk:
+ *
+ *   - control points of every geometry, in place
+ *   - blend shape target control points
+ *   - node translations, pivots and offsets, and geometric translations
+ *   - translation animation keys (and user tangents)
+ *   - skin cluster bind matrices (TransformMatrix, TransformLinkMatrix)
+ *   - bind pose matrices
+ *
+ * The unit metadata is left unchanged.
+ *
+ * Usage:
+ *   fbxscale-native <input.fbx> <output.fbx> <scale_factor> [--trace <trace.json>]
+ *
+ * Build:
+ *   make
+ */
+
+#include "fbxscene_io.h"
+#include "tracer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+
+struct ScaleStats {
+    long long controlPoints;
+    long long shapePoints;
+    int geometries;
+    int nodes;
+    int curves;
+    long long keys;
+    int clusters;
+    int poseMatrices;
+
+    ScaleStats()
+        : controlPoints(0), shapePoints(0), geometries(0), nodes(0),
+          curves(0), keys(0), clusters(0), poseMatrices(0) {}
+};
+
+// Scale the xyz of count points in place, keeping w
+void ScalePoints(FbxVector4* points, int count, double scale) {
+    for (int i = 0; i < count; i++) {
+        double* values = points[i].mData;
+        values[0] *= scale;
+        values[1] *= scale;
+        values[2] *= scale;
+    }
+}
+
+void ScaleDouble3(FbxPropertyT<FbxDouble3>& property, double scale) {
+    FbxDouble3 value = property.Get();
+    property.Set(FbxDouble3(value[0] * scale, value[1] * scale, value[2] * scale));
+}
+
+void ScaleAffineTranslation(FbxAMatrix& matrix, double scale) {
+    FbxVector4 translation = matrix.GetT();
+    matrix.SetT(FbxVector4(translation[0] * scale, translation[1] * scale, translation[2] * scale, translation[3]));
+}
+
+// Control points, blend shape targets and skin bind matrices of every geometry.
+// Geometries are visited once even when several nodes instance them.
+void ScaleGeometry(FbxScene* scene, double scale, ScaleStats& stats) {
+    std::set<FbxShape*> scaledShapes;
+
+    int geometryCount = scene->GetGeometryCount();
+    for (int g = 0; g < geometryCount; g++) {
+        FbxGeometry* geometry = scene->GetGeometry(g);
+        if (!geometry) {
+            continue;
+        }
+
+        int pointCount = geometry->GetControlPointsCount();
+        if (pointCount > 0) {
+            ScalePoints(geometry->GetControlPoints(), pointCount, scale);
+            stats.controlPoints += pointCount;
+        }
+        stats.geometries++;
+
+        int skinCount = geometry->GetDeformerCount(FbxDeformer::eSkin);
+        for (int s = 0; s < skinCount; s++) {
+            FbxSkin* skin = static_cast<FbxSkin*>(geometry->GetDeformer(s, FbxDeformer::eSkin));
+            for (int c = 0; c < skin->GetClusterCount(); c++) {
+                FbxCluster* cluster = skin->GetCluster(c);
+                FbxAMatrix matrix;
+                cluster->GetTransformMatrix(matrix);
+                ScaleAffineTranslation(matrix, scale);
+                cluster->SetTransformMatrix(matrix);
+                cluster->GetTransformLinkMatrix(matrix);
+                ScaleAffineTranslation(matrix, scale);
+                cluster->SetTransformLinkMatrix(matrix);
+                stats.clusters++;
+            }
+        }
+
+        int blendShapeCount = geometry->GetDeformerCount(FbxDeformer::eBlendShape);
+        for (int b = 0; b < blendShapeCount; b++) {
+            FbxBlendShape* blendShape = static_cast<FbxBlendShape*>(geometry->GetDeformer(b, FbxDeformer::eBlendShape));
+            for (int ch = 0; ch < blendShape->GetBlendShapeChannelCount(); ch++) {
+                FbxBlendShapeChannel* channel = blendShape->GetBlendShapeChannel(ch);
+                for (int t = 0; t < channel->GetTargetShapeCount(); t++) {
+                    FbxShape* shape = channel->GetTargetShape(t);
+                    if (!shape || !scaledShapes.insert(shape).second) {
+                        continue;
+                    }
+                    int shapePointCount = shape->GetControlPointsCount();
+                    if (shapePointCount > 0) {
+                        ScalePoints(shape->GetControlPoints(), shapePointCount, scale);
+                        stats.shapePoints += shapePointCount;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Translations, pivots and offsets of every node
+void ScaleNodes(FbxScene* scene, double scale, ScaleStats& stats) {
+    int nodeCount = scene->GetNodeCount();
+    for (int i = 0; i < nodeCount; i++) {
+        FbxNode* node = scene->GetNode(i);
+        ScaleDouble3(node->LclTranslation, scale);
+        ScaleDouble3(node->RotationOffset, scale);
+        ScaleDouble3(node->RotationPivot, scale);
+        ScaleDouble3(node->ScalingOffset, scale);
+        ScaleDouble3(node->ScalingPivot, scale);
+        ScaleDouble3(node->GeometricTranslation, scale);
+        stats.nodes++;
+    }
+}
+
+// Translation keys of every animation layer. Auto tangents follow the new
+// values; user and break tangents are slopes in the same units, so they are
+// scaled too.
+void ScaleAnimation(FbxScene* scene, double scale, ScaleStats& stats) {
+    int stackCount = scene->GetSrcObjectCount<FbxAnimStack>();
+    int nodeCount = scene->GetNodeCount();
+    for (int s = 0; s < stackCount; s++) {
+        FbxAnimStack* stack = scene->GetSrcObject<FbxAnimStack>(s);
+        int layerCount = stack->GetMemberCount<FbxAnimLayer>();
+        for (int l = 0; l < layerCount; l++) {
+            FbxAnimLayer* layer = stack->GetMember<FbxAnimLayer>(l);
+            for (int n = 0; n < nodeCount; n++) {
+                FbxAnimCurveNode* curveNode = scene->GetNode(n)->LclTranslation.GetCurveNode(layer);
+                if (!curveNode) {
+                    continue;
+                }
+                for (unsigned int channel = 0; channel < curveNode->GetChannelsCount(); channel++) {
+                    for (int c = 0; c < curveNode->GetCurveCount(channel); c++) {
+                        FbxAnimCurve* curve = curveNode->GetCurve(channel, c);
+                        if (!curve) {
+                            continue;
+                        }
+                        int keyCount = curve->KeyGetCount();
+                        curve->KeyModifyBegin();
+                        for (int k = 0; k < keyCount; k++) {
+                            curve->KeySetValue(k, curve->KeyGetValue(k) * (float)scale);
+                            FbxAnimCurveDef::ETangentMode mode = curve->KeyGetTangentMode(k);
+                            if (mode & (FbxAnimCurveDef::eTangentUser | FbxAnimCurveDef::eTangentBreak)) {
+                                curve->KeySetLeftDerivative(k, curve->KeyGetLeftDerivative(k) * (float)scale);
+                                curve->KeySetRightDerivative(k, curve->KeyGetRightDerivative(k) * (float)scale);
+                            }
+                        }
+                        curve->KeyModifyEnd();
+                        stats.curves++;
+                        stats.keys += keyCount;
+                    }
+                }
+                // Default values used where a channel has no curve
+                for (unsigned int channel = 0; channel < curveNode->GetChannelsCount(); channel++) {
+                    curveNode->SetChannelValue<double>(channel, curveNode->GetChannelValue<double>(channel, 0.0) * scale);
+                }
+            }
+        }
+    }
+}
+
+// Bind pose matrices (the translation row of each node's global matrix)
+void ScalePoses(FbxScene* scene, double scale, ScaleStats& stats) {
+    int poseCount = scene->GetPoseCount();
+    for (int p = 0; p < poseCount; p++) {
+        FbxPose* pose = scene->GetPose(p);
+        for (int i = 0; i < pose->GetCount(); i++) {
+            FbxMatrix& matrix = pose->GetMatrix(i);
+            FbxVector4 row = matrix.GetRow(3);
+            matrix.SetRow(3, FbxVector4(row[0] * scale, row[1] * scale, row[2] * scale, row[3]));
+            stats.poseMatrices++;
+        }
+    }
+}
+
+void PrintUsage(const char* programName) {
+    fprintf(stderr, "Usage: %s <input.fbx> <output.fbx> <scale_factor> [options]\n", programName);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Scales FBX geometry, transforms and animation without changing the unit metadata.\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  --trace <file>         Write a Chrome trace-event JSON file of the phases\n");
+    fprintf(stderr, "  -h, --help             Show this help message\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Common scale factors:\n");
+    fprintf(stderr, "  0.01  Make 100x smaller\n");
+    fprintf(stderr, "  0.1   Make 10x smaller\n");
+    fprintf(stderr, "  10    Make 10x larger\n");
+    fprintf(stderr, "  100   Make 100x larger\n");
+}
+
+// Writes the trace file when main returns, including on errors
+struct TraceFileWriter {
+    const char* path;
+
+    ~TraceFileWriter() {
+        if (path && !Tracer::Instance().Write(path)) {
+            fprintf(stderr, "Warning: Failed to write trace: %s\n", path);
+        }
+    }
+};
+
+int main(int argc, char** argv) {
+    // Parse arguments
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    const char* scaleArg = nullptr;
+    const char* tracePath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 < argc) {
+                tracePath = argv[++i];
+            } else {
+                fprintf(stderr, "Error: --trace requires an argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Error: Unknown option: %s\n", argv[i]);
+            PrintUsage(argv[0]);
+            return 1;
+        } else if (!inputPath) {
+            inputPath = argv[i];
+        } else if (!outputPath) {
+            outputPath = argv[i];
+        } else if (!scaleArg) {
+            scaleArg = argv[i];
+        }
+    }
+
+    if (!inputPath || !outputPath || !scaleArg) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    char* end = nullptr;
+    double scale = strtod(scaleArg, &end);
+    if (end == scaleArg || *end != '\0' || !(scale > 0)) {
+        fprintf(stderr, "Error: Scale factor must be a positive number, got %s\n", scaleArg);
+        return 1;
+    }
+
+    if (tracePath) {
+        Tracer::Instance().Enable("fbxscale-native");
+    }
+    TraceFileWriter traceWriter = { tracePath };
+
+    // Initialize the FBX SDK
+    FbxManager* manager = CreateFbxManager();
+    if (!manager) {
+        return 1;
+    }
+
+    FbxScene* scene = nullptr;
+    {
+        TraceSpan span("FBX import", TraceArg("file", inputPath));
+        fprintf(stderr, "Loading: %s\n", inputPath);
+        scene = LoadFbxScene(manager, inputPath);
+    }
+    if (!scene) {
+        manager->Destroy();
+        return 1;
+    }
+
+    FbxSystemUnit unit = scene->GetGlobalSettings().GetSystemUnit();
+    fprintf(stderr, "Unit: %s (scale factor: %g)\n", unit.GetScaleFactorAsString().Buffer(), unit.GetScaleFactor());
+    fprintf(stderr, "Scaling by factor: %g\n", scale);
+
+    ScaleStats stats;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    {
+        TraceSpan span("Geometry");
+        ScaleGeometry(scene, scale, stats);
+    }
+    double geometrySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    {
+        TraceSpan span("Nodes");
+        ScaleNodes(scene, scale, stats);
+    }
+    {
+        TraceSpan span("Animation");
+        ScaleAnimation(scene, scale, stats);
+    }
+    {
+        TraceSpan span("Poses");
+        ScalePoses(scene, scale, stats);
+    }
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long points = stats.controlPoints + stats.shapePoints;
+    fprintf(stderr, "Scaled %lld control points in %d geometries (%lld blend shape points)\n",
+            stats.controlPoints, stats.geometries, stats.shapePoints);
+    fprintf(stderr, "Scaled %d nodes, %d skin clusters, %d bind pose matrices\n",
+            stats.nodes, stats.clusters, stats.poseMatrices);
+    fprintf(stderr, "Scaled %lld keys in %d translation curves\n", stats.keys, stats.curves);
+    if (geometrySeconds > 0) {
+        fprintf(stderr, "Geometry: %.1f ms, %.1f M vertices/s\n",
+                geometrySeconds * 1000.0, points / geometrySeconds / 1e6);
+    }
+    fprintf(stderr, "Total scaling: %.1f ms\n", totalSeconds * 1000.0);
+
+    fprintf(stderr, "Saving: %s\n", outputPath);
+
+    bool saved;
+    {
+        TraceSpan span("FBX export", TraceArg("file", outputPath));
+        saved = SaveFbxScene(manager, scene, outputPath);
+    }
+    manager->Destroy();
+    if (!saved) {
+        return 1;
+    }
+
+    fprintf(stderr, "Done!\n");
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * fbxscene_io.h - FBX SDK setup, scene loading and saving
+ *
+ * Shared by the C++ tools so they load and write files the same way: the
+ * importer detects the file format, and scenes are written as binary FBX.
+ * Errors are printed to stderr.
+ *
+ *   FbxManager* manager = CreateFbxManager();
+ *   FbxScene* scene = LoadFbxScene(manager, "in.fbx");
+ *   ...
+ *   SaveFbxScene(manager, scene, "out.fbx");
+ *   manager->Destroy();
+ */
+
+#ifndef FBXSCENE_IO_H
+#define FBXSCENE_IO_H
+
+#include "fbxsdk_fix.h"
+#include <cstdio>
+
+// Create the SDK manager with default IO settings, or nullptr on failure
+inline FbxManager* CreateFbxManager() {
+    FbxManager* manager = FbxManager::Create();
+    if (!manager) {
+        fprintf(stderr, "Error: Failed to create FBX Manager\n");
+        return nullptr;
+    }
+
+    FbxIOSettings* ios = FbxIOSettings::Create(manager, IOSROOT);
+    manager->SetIOSettings(ios);
+    return manager;
+}
+
+// Import a file into a new scene, or return nullptr
+inline FbxScene* LoadFbxScene(FbxManager* manager, const char* path) {
+    FbxScene* scene = FbxScene::Create(manager, "");
+    FbxImporter* importer = FbxImporter::Create(manager, "");
+
+    if (!importer->Initialize(path, -1, manager->GetIOSettings())) {
+        fprintf(stderr, "Error: Failed to initialize importer: %s\n",
+                importer->GetStatus().GetErrorString());
+        importer->Destroy();
+        return nullptr;
+    }
+
+    if (!importer->Import(scene)) {
+        fprintf(stderr, "Error: Failed to import scene: %s\n",
+                importer->GetStatus().GetErrorString());
+        importer->Destroy();
+        return nullptr;
+    }
+
+    importer->Destroy();
+    return scene;
+}
+
+// Binary FBX writer, or the native format if there is none
+inline int FindBinaryFbxWriterFormat(FbxManager* manager) {
+    FbxIOPluginRegistry* registry = manager->GetIOPluginRegistry();
+    int formatCount = registry->GetWriterFormatCount();
+
+    for (int i = 0; i < formatCount; i++) {
+        if (registry->WriterIsFBX(i)) {
+            FbxString desc = registry->GetWriterFormatDescription(i);
+            if (desc.Find("binary") >= 0) {
+                return i;
+            }
+        }
+    }
+
+    return registry->GetNativeWriterFormat();
+}
+
+// Export a scene as binary FBX
+inline bool SaveFbxScene(FbxManager* manager, FbxScene* scene, const char* path) {
+    FbxExporter* exporter = FbxExporter::Create(manager, "");
+
+    if (!exporter->Initialize(path, FindBinaryFbxWriterFormat(manager), manager->GetIOSettings())) {
+        fprintf(stderr, "Error: Failed to initialize exporter: %s\n",
+                exporter->GetStatus().GetErrorString());
+        exporter->Destroy();
+        return false;
+    }
+
+    if (!exporter->Export(scene)) {
+        fprintf(stderr, "Error: Failed to export scene: %s\n",
+                exporter->GetStatus().GetErrorString());
+        exporter->Destroy();
+        return false;
+    }
+
+    exporter->Destroy();
+    return true;
+}
+
+#endif // FBXSCENE_IO_H
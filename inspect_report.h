@@ -0,0 +1,175 @@
+/**
+ * inspect_report.h - Markdown report helpers for the native inspect tools
+ *
+ * fbxinspect-native and usdinspect-native print the same reports as their
+ * Python counterparts. These helpers format numbers and tables the way
+ * Python prints them so the output matches byte for byte.
+ */
+
+#ifndef INSPECT_REPORT_H
+#define INSPECT_REPORT_H
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// printf to the end of a string
+inline void Appendf(std::string& out, const char* format, ...) {
+    char buffer[1024];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) {
+        return;
+    }
+    if ((size_t)length < sizeof(buffer)) {
+        out.append(buffer, length);
+        return;
+    }
+    std::vector<char> large(length + 1);
+    va_start(args, format);
+    vsnprintf(&large[0], large.size(), format, args);
+    va_end(args);
+    out.append(&large[0], length);
+}
+
+// Python's repr() of a float: the shortest digits that round-trip, in fixed
+// notation for exponents -4..15 and scientific notation otherwise
+inline std::string PyFloat(double value) {
+    if (std::isinf(value)) {
+        return value > 0 ? "inf" : "-inf";
+    }
+    if (std::isnan(value)) {
+        return "nan";
+    }
+
+    char buffer[40];
+    for (int precision = 1; precision <= 17; precision++) {
+        snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, value);
+        if (strtod(buffer, nullptr) == value) {
+            break;
+        }
+    }
+
+    // buffer is [-]d[.ddd]e(+|-)xx
+    std::string text(buffer);
+    std::string sign = text[0] == '-' ? "-" : "";
+    size_t e = text.find('e');
+    std::string digits;
+    for (size_t i = sign.size(); i < e; i++) {
+        if (text[i] != '.') {
+            digits += text[i];
+        }
+    }
+    int exponent = atoi(text.c_str() + e + 1);
+
+    if (exponent >= -4 && exponent < 16) {
+        if (exponent < 0) {
+            return sign + "0." + std::string(-exponent - 1, '0') + digits;
+        }
+        if ((int)digits.size() <= exponent + 1) {
+            return sign + digits + std::string(exponent + 1 - digits.size(), '0') + ".0";
+        }
+        return sign + digits.substr(0, exponent + 1) + "." + digits.substr(exponent + 1);
+    }
+
+    std::string mantissa = digits.substr(0, 1);
+    if (digits.size() > 1) {
+        mantissa += "." + digits.substr(1);
+    }
+    snprintf(buffer, sizeof(buffer), "e%c%02d", exponent < 0 ? '-' : '+', exponent < 0 ? -exponent : exponent);
+    return sign + mantissa + buffer;
+}
+
+// Python's f"{value:.<decimals>f}"
+inline std::string Fixed(double value, int decimals) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    return buffer;
+}
+
+inline std::string Int(long long value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%lld", value);
+    return buffer;
+}
+
+// Length in code points, as Python's len() counts it
+inline size_t Utf8Length(const std::string& text) {
+    size_t length = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (((unsigned char)text[i] & 0xC0) != 0x80) {
+            length++;
+        }
+    }
+    return length;
+}
+
+// os.path.basename
+inline std::string Basename(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+typedef std::vector<std::string> Row;
+
+// Table with every column padded to its widest cell
+inline void PrintMarkdownTable(std::string& out, const Row& headers, const std::vector<Row>& rows) {
+    if (rows.empty()) {
+        return;
+    }
+
+    std::vector<size_t> widths;
+    for (size_t i = 0; i < headers.size(); i++) {
+        widths.push_back(Utf8Length(headers[i]));
+    }
+    for (size_t r = 0; r < rows.size(); r++) {
+        for (size_t i = 0; i < rows[r].size(); i++) {
+            size_t length = Utf8Length(rows[r][i]);
+            if (length > widths[i]) {
+                widths[i] = length;
+            }
+        }
+    }
+
+    std::vector<Row> lines(1, headers);
+    lines.insert(lines.end(), rows.begin(), rows.end());
+    for (size_t r = 0; r < lines.size(); r++) {
+        out += "|";
+        for (size_t i = 0; i < lines[r].size(); i++) {
+            out += " " + lines[r][i] + std::string(widths[i] - Utf8Length(lines[r][i]), ' ') + " |";
+        }
+        out += "\n";
+        if (r == 0) {
+            out += "|";
+            for (size_t i = 0; i < widths.size(); i++) {
+                out += std::string(widths[i] + 2, '-') + "|";
+            }
+            out += "\n";
+        }
+    }
+}
+
+// Copy a report to the pasteboard and open it in Marked 2, like the -m
+// option of the Python tools
+inline bool OpenInMarked(const std::string& report) {
+    FILE* pasteboard = popen("pbcopy", "w");
+    if (!pasteboard) {
+        fprintf(stderr, "Error: Failed to run pbcopy\n");
+        return false;
+    }
+    fwrite(report.data(), 1, report.size(), pasteboard);
+    pclose(pasteboard);
+    if (system("open x-marked://paste") != 0) {
+        fprintf(stderr, "Warning: Failed to open Marked 2\n");
+    }
+    printf("Output copied to pasteboard and opened in Marked 2\n");
+    return true;
+}
+
+#endif // INSPECT_REPORT_H
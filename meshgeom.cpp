@@ -0,0 +1,345 @@
+/**
+ * meshgeom - Smooth normal and tangent generation for fbx2usd
+ *
+ * A small shared library with a C interface, loaded by fbx2usd through
+ * ctypes. It has no FBX SDK or USD dependency: meshes are passed as flat
+ * arrays in the layout fbx2usd authors them (points, face vertex counts,
+ * face vertex indices), and results are per face-vertex ("corner"), matching
+ * faceVarying primvars.
+ *
+ * Work is split over polygon ranges and then over vertex ranges, on
+ * threadCount threads. Each thread only writes the corners of its own
+ * polygons or vertices, so no locking is needed.
+ *
+ * Build:
+ *   make meshgeom
+ */
+
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Vec3 {
+    float x, y, z;
+
+    Vec3() : x(0), y(0), z(0) {}
+    Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    Vec3 operator+(const Vec3& o) const { return Vec3(x + o.x, y + o.y, z + o.z); }
+    Vec3 operator-(const Vec3& o) const { return Vec3(x - o.x, y - o.y, z - o.z); }
+    Vec3 operator*(float s) const { return Vec3(x * s, y * s, z * s); }
+    Vec3& operator+=(const Vec3& o) { x += o.x; y += o.y; z += o.z; return *this; }
+};
+
+inline float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 Cross(const Vec3& a, const Vec3& b) {
+    return Vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+inline float Length(const Vec3& v) { return std::sqrt(Dot(v, v)); }
+
+// Returns false (and leaves v unchanged) for zero-length vectors
+inline bool Normalize(Vec3& v) {
+    float length = Length(v);
+    if (length <= 1e-20f) {
+        return false;
+    }
+    v = v * (1.0f / length);
+    return true;
+}
+
+inline Vec3 Load3(const float* values, int index) {
+    return Vec3(values[index * 3], values[index * 3 + 1], values[index * 3 + 2]);
+}
+
+inline void Store3(float* values, int index, const Vec3& v) {
+    values[index * 3] = v.x;
+    values[index * 3 + 1] = v.y;
+    values[index * 3 + 2] = v.z;
+}
+
+// Any unit vector perpendicular to n
+Vec3 Perpendicular(const Vec3& n) {
+    Vec3 axis = std::fabs(n.x) < 0.9f ? Vec3(1, 0, 0) : Vec3(0, 1, 0);
+    Vec3 t = Cross(n, axis);
+    Normalize(t);
+    return t;
+}
+
+// Interior angle at corner p of the polygon edges p->next and p->prev
+float CornerAngle(const Vec3& p, const Vec3& prev, const Vec3& next) {
+    Vec3 a = next - p;
+    Vec3 b = prev - p;
+    if (!Normalize(a) || !Normalize(b)) {
+        return 0.0f;
+    }
+    float cosine = Dot(a, b);
+    cosine = cosine < -1.0f ? -1.0f : (cosine > 1.0f ? 1.0f : cosine);
+    return std::acos(cosine);
+}
+
+// Calls fn(begin, end) on up to threadCount threads over [0, count)
+template <typename Fn>
+void ParallelFor(int count, int threadCount, Fn fn) {
+    if (threadCount > count / 1024) {
+        threadCount = count / 1024;
+    }
+    if (threadCount <= 1) {
+        fn(0, count);
+        return;
+    }
+    std::vector<std::thread> threads;
+    int step = (count + threadCount - 1) / threadCount;
+    for (int begin = 0; begin < count; begin += step) {
+        int end = begin + step < count ? begin + step : count;
+        threads.push_back(std::thread(fn, begin, end));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+// Polygon layout shared by both passes: the first corner of each face, and
+// the corners at each vertex (CSR: vertexCorners[vertexStart[v] .. vertexStart[v + 1]])
+struct Topology {
+    std::vector<int> faceStart;
+    std::vector<int> cornerFace;
+    std::vector<int> vertexStart;
+    std::vector<int> vertexCorners;
+
+    bool Build(int pointCount, const int* faceCounts, int faceCount, const int* faceIndices) {
+        faceStart.resize(faceCount + 1);
+        faceStart[0] = 0;
+        for (int f = 0; f < faceCount; f++) {
+            if (faceCounts[f] < 0) {
+                return false;
+            }
+            faceStart[f + 1] = faceStart[f] + faceCounts[f];
+        }
+        int cornerCount = faceStart[faceCount];
+
+        cornerFace.resize(cornerCount);
+        vertexStart.assign(pointCount + 1, 0);
+        for (int f = 0; f < faceCount; f++) {
+            for (int c = faceStart[f]; c < faceStart[f + 1]; c++) {
+                int v = faceIndices[c];
+                if (v < 0 || v >= pointCount) {
+                    return false;
+                }
+                cornerFace[c] = f;
+                vertexStart[v + 1]++;
+            }
+        }
+        for (int v = 0; v < pointCount; v++) {
+            vertexStart[v + 1] += vertexStart[v];
+        }
+
+        vertexCorners.resize(cornerCount);
+        std::vector<int> fill(vertexStart.begin(), vertexStart.end() - 1);
+        for (int c = 0; c < cornerCount; c++) {
+            vertexCorners[fill[faceIndices[c]]++] = c;
+        }
+        return true;
+    }
+
+    int Prev(int c) const {
+        int f = cornerFace[c];
+        return c == faceStart[f] ? faceStart[f + 1] - 1 : c - 1;
+    }
+
+    int Next(int c) const {
+        int f = cornerFace[c];
+        return c + 1 == faceStart[f + 1] ? faceStart[f] : c + 1;
+    }
+};
+
+} // namespace
+
+extern "C" {
+
+/**
+ * Angle-weighted smooth normals, one per corner (3 floats each).
+ *
+ * Each polygon's normal (Newell's method, so n-gons and slightly non-planar
+ * faces are handled) is weighted by the polygon's interior angle at the
+ * vertex. With smoothingGroups (one bitmask per face, or NULL), a corner only
+ * averages faces whose groups share a bit with its own, and faces in group 0
+ * are flat-shaded; without them all faces at a vertex are averaged.
+ *
+ * Returns 0 on success, -1 if the topology is invalid.
+ */
+int meshgeom_smooth_normals(const float* points, int pointCount,
+                            const int* faceCounts, int faceCount, const int* faceIndices,
+                            const int* smoothingGroups, float* outNormals, int threadCount) {
+    Topology topology;
+    if (!topology.Build(pointCount, faceCounts, faceCount, faceIndices)) {
+        return -1;
+    }
+    int cornerCount = topology.faceStart[faceCount];
+
+    // Pass 1, per face: face normal, and its angle-weighted share at each corner
+    std::vector<Vec3> faceNormals(faceCount);
+    std::vector<Vec3> cornerShare(cornerCount);
+    ParallelFor(faceCount, threadCount, [&](int begin, int end) {
+        for (int f = begin; f < end; f++) {
+            int first = topology.faceStart[f];
+            int last = topology.faceStart[f + 1];
+            Vec3 normal;
+            for (int c = first; c < last; c++) {
+                Vec3 p = Load3(points, faceIndices[c]);
+                Vec3 q = Load3(points, faceIndices[topology.Next(c)]);
+                normal += Vec3((p.y - q.y) * (p.z + q.z), (p.z - q.z) * (p.x + q.x), (p.x - q.x) * (p.y + q.y));
+            }
+            Normalize(normal);
+            faceNormals[f] = normal;
+            for (int c = first; c < last; c++) {
+                float angle = CornerAngle(Load3(points, faceIndices[c]),
+                                          Load3(points, faceIndices[topology.Prev(c)]),
+                                          Load3(points, faceIndices[topology.Next(c)]));
+                cornerShare[c] = normal * angle;
+            }
+        }
+    });
+
+    // Pass 2, per vertex: sum the shares of the faces each corner is smoothed with
+    ParallelFor(pointCount, threadCount, [&](int begin, int end) {
+        for (int v = begin; v < end; v++) {
+            int first = topology.vertexStart[v];
+            int last = topology.vertexStart[v + 1];
+            if (!smoothingGroups) {
+                Vec3 sum;
+                for (int i = first; i < last; i++) {
+                    sum += cornerShare[topology.vertexCorners[i]];
+                }
+                Normalize(sum);
+                for (int i = first; i < last; i++) {
+                    int c = topology.vertexCorners[i];
+                    Store3(outNormals, c, Length(sum) > 0 ? sum : faceNormals[topology.cornerFace[c]]);
+                }
+                continue;
+            }
+            for (int i = first; i < last; i++) {
+                int c = topology.vertexCorners[i];
+                int group = smoothingGroups[topology.cornerFace[c]];
+                Vec3 sum = cornerShare[c];
+                if (group != 0) {
+                    for (int j = first; j < last; j++) {
+                        int d = topology.vertexCorners[j];
+                        if (d != c && (smoothingGroups[topology.cornerFace[d]] & group) != 0) {
+                            sum += cornerShare[d];
+                        }
+                    }
+                }
+                if (!Normalize(sum)) {
+                    sum = faceNormals[topology.cornerFace[c]];
+                }
+                Store3(outNormals, c, sum);
+            }
+        }
+    });
+    return 0;
+}
+
+/**
+ * Tangents for normal mapping, one per corner (4 floats each: the tangent
+ * and the bitangent sign, B = sign * cross(N, T)).
+ *
+ * Follows the MikkTSpace conventions: per-corner tangents are projected into
+ * the plane of the corner normal and weighted by the corner angle, then
+ * averaged over the corners that share a vertex, normal, UV and handedness,
+ * so UV seams and mirrored UVs keep separate tangents.
+ *
+ * normals and uvs are per corner (3 and 2 floats). Returns 0 on success, -1
+ * if the topology is invalid.
+ */
+int meshgeom_tangents(const float* points, int pointCount,
+                      const int* faceCounts, int faceCount, const int* faceIndices,
+                      const float* normals, const float* uvs, float* outTangents, int threadCount) {
+    Topology topology;
+    if (!topology.Build(pointCount, faceCounts, faceCount, faceIndices)) {
+        return -1;
+    }
+    int cornerCount = topology.faceStart[faceCount];
+
+    // Pass 1, per face: the UV gradient at each corner, from its two edges
+    std::vector<Vec3> cornerTangent(cornerCount);
+    std::vector<Vec3> cornerBitangent(cornerCount);
+    ParallelFor(faceCount, threadCount, [&](int begin, int end) {
+        for (int f = begin; f < end; f++) {
+            for (int c = topology.faceStart[f]; c < topology.faceStart[f + 1]; c++) {
+                int prev = topology.Prev(c);
+                int next = topology.Next(c);
+                Vec3 p = Load3(points, faceIndices[c]);
+                Vec3 e1 = Load3(points, faceIndices[next]) - p;
+                Vec3 e2 = Load3(points, faceIndices[prev]) - p;
+                float du1 = uvs[next * 2] - uvs[c * 2];
+                float dv1 = uvs[next * 2 + 1] - uvs[c * 2 + 1];
+                float du2 = uvs[prev * 2] - uvs[c * 2];
+                float dv2 = uvs[prev * 2 + 1] - uvs[c * 2 + 1];
+
+                float area = du1 * dv2 - du2 * dv1;
+                if (std::fabs(area) <= 1e-20f) {
+                    continue;
+                }
+                Vec3 n = Load3(normals, c);
+                Vec3 t = (e1 * dv2 - e2 * dv1) * (1.0f / area);
+                Vec3 b = (e2 * du1 - e1 * du2) * (1.0f / area);
+                t = t - n * Dot(n, t);
+                b = b - n * Dot(n, b);
+                if (!Normalize(t)) {
+                    continue;
+                }
+                Normalize(b);
+
+                float angle = CornerAngle(p, p + e2, p + e1);
+                cornerTangent[c] = t * angle;
+                cornerBitangent[c] = b * angle;
+            }
+        }
+    });
+
+    // Pass 2, per vertex: average corners with the same normal, UV and handedness
+    ParallelFor(pointCount, threadCount, [&](int begin, int end) {
+        for (int v = begin; v < end; v++) {
+            int first = topology.vertexStart[v];
+            int last = topology.vertexStart[v + 1];
+            for (int i = first; i < last; i++) {
+                int c = topology.vertexCorners[i];
+                Vec3 n = Load3(normals, c);
+                bool flipped = Dot(Cross(n, cornerTangent[c]), cornerBitangent[c]) < 0;
+
+                Vec3 t;
+                Vec3 b;
+                for (int j = first; j < last; j++) {
+                    int d = topology.vertexCorners[j];
+                    if (d != c) {
+                        if (std::memcmp(normals + d * 3, normals + c * 3, 3 * sizeof(float)) != 0 ||
+                            std::memcmp(uvs + d * 2, uvs + c * 2, 2 * sizeof(float)) != 0 ||
+                            (Dot(Cross(n, cornerTangent[d]), cornerBitangent[d]) < 0) != flipped) {
+                            continue;
+                        }
+                    }
+                    t += cornerTangent[d];
+                    b += cornerBitangent[d];
+                }
+
+                // Gram-Schmidt against the normal
+                t = t - n * Dot(n, t);
+                if (!Normalize(t)) {
+                    t = Perpendicular(n);
+                }
+                float sign = Dot(Cross(n, t), b) < 0 ? -1.0f : 1.0f;
+
+                outTangents[c * 4] = t.x;
+                outTangents[c * 4 + 1] = t.y;
+                outTangents[c * 4 + 2] = t.z;
+                outTangents[c * 4 + 3] = sign;
+            }
+        }
+    });
+    return 0;
+}
+
+} // extern "C"
@@ -0,0 +1,472 @@
+"""
+scenecache - memory-mapped cache of imported FBX scenes
+
+Importing a large FBX file through the SDK is the slowest step of every
+tool. scenecache flattens an imported scene into a versioned binary file,
+keyed by a hash of the FBX file's contents. Later runs memory-map it
+instead of importing again:
+
+    data = scenecache.load("character.fbx", cache_dir)   # imports only on a miss
+    names = data.meta['nodes']['names']
+    parents = data.array('nodes/parent')                 # zero-copy memoryview
+
+The file holds the node hierarchy (names, attribute types, parents, local
+TRS and global transforms at the default time), mesh arrays (control
+points, polygon sizes and vertex indices), skin clusters, materials, and
+the keys of every animation curve. It is the scene as stored in the file,
+before any axis or unit conversion.
+
+Layout (native byte order, recorded in the table of contents):
+
+    header    magic, version, table of contents offset and size
+    arrays    raw typed arrays, each 16-byte aligned
+    contents  JSON: {'meta': ..., 'arrays': {name: [offset, typecode, length]}}
+
+Files with another magic, version or byte order are treated as misses.
+"""
+
+import hashlib
+import json
+import mmap
+import os
+import struct
+import sys
+import tempfile
+from array import array
+
+MAGIC = b'FBXCACHE'
+VERSION = 1
+HEADER = struct.Struct('<8sIIQQ')
+ALIGNMENT = 16
+
+# Cached scenes go here unless a directory is given
+DEFAULT_CACHE_DIR = os.environ.get('FBX2USD_CACHE_DIR') or os.path.join(
+    os.environ.get('XDG_CACHE_HOME') or os.path.expanduser('~/.cache'), 'fbx2usd')
+
+
+class CacheError(Exception):
+    pass
+
+
+class SceneData:
+    """A flattened scene: JSON-compatible metadata and named typed arrays"""
+
+    def __init__(self, meta, arrays):
+        self.meta = meta
+        self.arrays = arrays
+        self._children = None
+
+    def array(self, name):
+        """Typed memoryview of an array"""
+        return memoryview(self.arrays[name])
+
+    def has_array(self, name):
+        return name in self.arrays
+
+    def children(self):
+        """Child node indices of every node, in scene order"""
+        if self._children is None:
+            self._children = [[] for _ in self.meta['nodes']['names']]
+            for index, parent in enumerate(self.array('nodes/parent')):
+                if parent >= 0:
+                    self._children[parent].append(index)
+        return self._children
+
+    def global_transform(self, node):
+        """Row-major 4x4 global transform of a node, as FbxAMatrix stores it"""
+        return self.array('nodes/global')[node * 16:node * 16 + 16]
+
+    def write(self, path):
+        """Write the cache file atomically, so readers never see a partial file"""
+        directory = os.path.dirname(path) or '.'
+        os.makedirs(directory, exist_ok=True)
+        fd, temp_path = tempfile.mkstemp(dir=directory, suffix='.tmp')
+        try:
+            with os.fdopen(fd, 'wb') as f:
+                f.write(b'\0' * HEADER.size)
+                toc = {}
+                for name, values in self.arrays.items():
+                    f.write(b'\0' * (-f.tell() % ALIGNMENT))
+                    toc[name] = [f.tell(), values.typecode, len(values)]
+                    values.tofile(f)
+
+                contents = json.dumps({'byteorder': sys.byteorder, 'meta': self.meta, 'arrays': toc},
+                                      ensure_ascii=False).encode('utf-8')
+                toc_offset = f.tell()
+                f.write(contents)
+                f.seek(0)
+                f.write(HEADER.pack(MAGIC, VERSION, 0, toc_offset, len(contents)))
+            os.replace(temp_path, path)
+        except BaseException:
+            os.unlink(temp_path)
+            raise
+
+
+class SceneCache(SceneData):
+    """A cache file, memory-mapped. Arrays are views into the mapping, so
+    they are only paged in when read."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            try:
+                self.map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            except ValueError:
+                raise CacheError(f"Empty cache file: {path}")
+
+        if len(self.map) < HEADER.size:
+            raise CacheError(f"Truncated cache file: {path}")
+        magic, version, _, toc_offset, toc_size = HEADER.unpack_from(self.map, 0)
+        if magic != MAGIC or version != VERSION:
+            raise CacheError(f"Not a version {VERSION} scene cache: {path}")
+
+        try:
+            contents = json.loads(self.map[toc_offset:toc_offset + toc_size].decode('utf-8'))
+        except ValueError:
+            raise CacheError(f"Corrupt cache file: {path}")
+        if contents['byteorder'] != sys.byteorder:
+            raise CacheError(f"Cache file written on a {contents['byteorder']}-endian machine: {path}")
+
+        super().__init__(contents['meta'], contents['arrays'])
+        self.view = memoryview(self.map)
+
+    def array(self, name):
+        offset, typecode, length = self.arrays[name]
+        return self.view[offset:offset + length * array(typecode).itemsize].cast(typecode)
+
+
+def file_hash(path):
+    """BLAKE2b of a file's contents"""
+    digest = hashlib.blake2b(digest_size=20)
+    with open(path, 'rb') as f:
+        while chunk := f.read(1 << 20):
+            digest.update(chunk)
+    return digest.hexdigest()
+
+
+def cache_path(fbx_path, cache_dir=None):
+    return os.path.join(cache_dir or DEFAULT_CACHE_DIR, f"{file_hash(fbx_path)}.fbxcache")
+
+
+def load_fbx_scene(filepath):
+    """Load an FBX scene from file, returns (manager, scene) or (None, None)"""
+    from fbx import FbxManager, FbxIOSettings, FbxScene, FbxImporter, IOSROOT
+
+    manager = FbxManager.Create()
+    if not manager:
+        return None, None
+
+    ios = FbxIOSettings.Create(manager, IOSROOT)
+    manager.SetIOSettings(ios)
+
+    scene = FbxScene.Create(manager, "")
+    importer = FbxImporter.Create(manager, "")
+
+    if not importer.Initialize(filepath, -1, manager.GetIOSettings()):
+        print(f"Error: Failed to initialize importer: {importer.GetStatus().GetErrorString()}", file=sys.stderr)
+        importer.Destroy()
+        manager.Destroy()
+        return None, None
+
+    if not importer.Import(scene):
+        print(f"Error: Failed to import scene: {importer.GetStatus().GetErrorString()}", file=sys.stderr)
+        importer.Destroy()
+        manager.Destroy()
+        return None, None
+
+    importer.Destroy()
+    return manager, scene
+
+
+def load(fbx_path, cache_dir=None):
+    """The cached scene for an FBX file, importing and caching it on a miss.
+    Returns None if the file can't be imported."""
+    path = cache_path(fbx_path, cache_dir)
+    if os.path.exists(path):
+        try:
+            return SceneCache(path)
+        except (CacheError, OSError, KeyError):
+            pass
+
+    manager, scene = load_fbx_scene(fbx_path)
+    if not scene:
+        return None
+    try:
+        data = extract(scene)
+    finally:
+        manager.Destroy()
+
+    try:
+        data.write(path)
+        return SceneCache(path)
+    except OSError as e:
+        print(f"Warning: Could not write scene cache {path}: {e}", file=sys.stderr)
+        return data
+
+
+# ---------------------------------------------------------------------------
+# Extraction
+# ---------------------------------------------------------------------------
+
+def attribute_type_names():
+    from fbx import FbxNodeAttribute
+
+    return {
+        FbxNodeAttribute.EType.eUnknown: "Unknown",
+        FbxNodeAttribute.EType.eNull: "Null",
+        FbxNodeAttribute.EType.eMarker: "Marker",
+        FbxNodeAttribute.EType.eSkeleton: "Skeleton",
+        FbxNodeAttribute.EType.eMesh: "Mesh",
+        FbxNodeAttribute.EType.eNurbs: "Nurbs",
+        FbxNodeAttribute.EType.ePatch: "Patch",
+        FbxNodeAttribute.EType.eCamera: "Camera",
+        FbxNodeAttribute.EType.eCameraStereo: "CameraStereo",
+        FbxNodeAttribute.EType.eCameraSwitcher: "CameraSwitcher",
+        FbxNodeAttribute.EType.eLight: "Light",
+        FbxNodeAttribute.EType.eOpticalReference: "OpticalReference",
+        FbxNodeAttribute.EType.eOpticalMarker: "OpticalMarker",
+        FbxNodeAttribute.EType.eNurbsCurve: "NurbsCurve",
+        FbxNodeAttribute.EType.eTrimNurbsSurface: "TrimNurbsSurface",
+        FbxNodeAttribute.EType.eBoundary: "Boundary",
+        FbxNodeAttribute.EType.eNurbsSurface: "NurbsSurface",
+        FbxNodeAttribute.EType.eShape: "Shape",
+        FbxNodeAttribute.EType.eLODGroup: "LODGroup",
+        FbxNodeAttribute.EType.eSubDiv: "SubDiv",
+    }
+
+
+def extract_scene_info(scene):
+    from fbx import FbxAxisSystem, FbxTime
+
+    global_settings = scene.GetGlobalSettings()
+    time_mode = global_settings.GetTimeMode()
+    axis_system = global_settings.GetAxisSystem()
+    system_unit = global_settings.GetSystemUnit()
+    scene_info = scene.GetSceneInfo()
+
+    # Same up axis rules as fbxinspect has always used
+    if axis_system == FbxAxisSystem.MayaYUp or axis_system == FbxAxisSystem.OpenGL:
+        up_axis = 'Y'
+    elif axis_system == FbxAxisSystem.MayaZUp or axis_system == FbxAxisSystem.Max:
+        up_axis = 'Z'
+    else:
+        up_axis = {2: 'Y', 3: 'Z'}.get(axis_system.GetUpVector()[0], 'Y')
+
+    return {
+        'time_mode': int(time_mode),
+        'fps': FbxTime.GetFrameRate(time_mode),
+        'global_fps': FbxTime.GetFrameRate(FbxTime.GetGlobalTimeMode()),
+        'up_axis': up_axis,
+        'coord_system': 'Right-Handed' if axis_system.GetCoorSystem() == 0 else 'Left-Handed',
+        'unit_scale': system_unit.GetScaleFactor(),
+        'unit_name': str(system_unit.GetScaleFactorAsString()),
+        'title': scene_info.mTitle.Buffer() if scene_info and scene_info.mTitle else "",
+        'author': scene_info.mAuthor.Buffer() if scene_info and scene_info.mAuthor else "",
+        'comment': scene_info.mComment.Buffer() if scene_info and scene_info.mComment else "",
+        'material_count': scene.GetMaterialCount(),
+        'texture_count': scene.GetTextureCount(),
+    }
+
+
+def extract_nodes(scene, arrays):
+    """Nodes in depth-first order, root first, so children follow their parent"""
+    type_names = attribute_type_names()
+    names, types = [], []
+    parents = array('i')
+    translations, rotations, scales, transforms = array('d'), array('d'), array('d'), array('d')
+    nodes = []
+
+    stack = [(scene.GetRootNode(), -1)]
+    while stack:
+        node, parent = stack.pop()
+        index = len(nodes)
+        nodes.append(node)
+
+        attr = node.GetNodeAttribute()
+        names.append(node.GetName())
+        types.append(type_names.get(attr.GetAttributeType(), "Unknown") if attr else "")
+        parents.append(parent)
+        translations.extend(node.LclTranslation.Get()[i] for i in range(3))
+        rotations.extend(node.LclRotation.Get()[i] for i in range(3))
+        scales.extend(node.LclScaling.Get()[i] for i in range(3))
+        transform = node.EvaluateGlobalTransform()
+        transforms.extend(transform.Get(row, column) for row in range(4) for column in range(4))
+
+        for i in reversed(range(node.GetChildCount())):
+            stack.append((node.GetChild(i), index))
+
+    arrays['nodes/parent'] = parents
+    arrays['nodes/translation'] = translations
+    arrays['nodes/rotation'] = rotations
+    arrays['nodes/scale'] = scales
+    arrays['nodes/global'] = transforms
+    return {'names': names, 'types': types}, nodes
+
+
+def extract_meshes(nodes, types, node_indices, arrays):
+    from fbx import FbxDeformer
+
+    meshes = []
+    for index, node in enumerate(nodes):
+        mesh = node.GetMesh() if types[index] == "Mesh" else None
+        if not mesh:
+            continue
+
+        prefix = f"meshes/{len(meshes)}"
+        points = array('d')
+        for i in range(mesh.GetControlPointsCount()):
+            point = mesh.GetControlPointAt(i)
+            points.extend((point[0], point[1], point[2]))
+        arrays[f"{prefix}/points"] = points
+        arrays[f"{prefix}/counts"] = array('i', (mesh.GetPolygonSize(i) for i in range(mesh.GetPolygonCount())))
+        arrays[f"{prefix}/indices"] = array('i', mesh.GetPolygonVertices())
+
+        info = {
+            'node': index,
+            'uv_sets': mesh.GetElementUVCount(),
+            'materials': node.GetMaterialCount(),
+            'blend_shapes': mesh.GetDeformerCount(FbxDeformer.EDeformerType.eBlendShape),
+            'clusters': None,
+        }
+
+        skin = mesh.GetDeformer(0, FbxDeformer.EDeformerType.eSkin) \
+            if mesh.GetDeformerCount(FbxDeformer.EDeformerType.eSkin) > 0 else None
+        if skin:
+            # Clusters' points and weights one after another in skin/indices and skin/weights
+            info['clusters'] = []
+            indices, weights = array('i'), array('d')
+            for c in range(skin.GetClusterCount()):
+                cluster = skin.GetCluster(c)
+                link = cluster.GetLink()
+                count = cluster.GetControlPointIndicesCount()
+                info['clusters'].append({
+                    'joint': node_indices.get(link.GetUniqueID(), -1) if link else -1,
+                    'count': count,
+                })
+                indices.extend(cluster.GetControlPointIndices()[:count])
+                weights.extend(cluster.GetControlPointWeights()[:count])
+            arrays[f"{prefix}/skin/indices"] = indices
+            arrays[f"{prefix}/skin/weights"] = weights
+
+        meshes.append(info)
+    return meshes
+
+
+def extract_materials(scene):
+    from fbx import FbxSurfaceMaterial, FbxSurfaceLambert, FbxSurfacePhong, FbxFileTexture
+
+    texture_properties = [
+        (FbxSurfaceMaterial.sDiffuse, 'Diffuse'),
+        (FbxSurfaceMaterial.sNormalMap, 'Normal'),
+        (FbxSurfaceMaterial.sSpecular, 'Specular'),
+        (FbxSurfaceMaterial.sEmissive, 'Emissive'),
+        (FbxSurfaceMaterial.sBump, 'Bump'),
+    ]
+
+    materials = []
+    for i in range(scene.GetMaterialCount()):
+        material = scene.GetMaterial(i)
+        if not material:
+            continue
+
+        if isinstance(material, FbxSurfacePhong):
+            shading_model = 'Phong'
+        elif isinstance(material, FbxSurfaceLambert):
+            shading_model = 'Lambert'
+        else:
+            shading_model = 'Unknown'
+
+        textures = []
+        for prop_name, tex_type in texture_properties:
+            prop = material.FindProperty(prop_name)
+            if prop.IsValid():
+                for j in range(prop.GetSrcObjectCount()):
+                    tex = prop.GetSrcObject(j)
+                    if isinstance(tex, FbxFileTexture):
+                        textures.append({'type': tex_type, 'path': tex.GetFileName()})
+
+        materials.append({'name': material.GetName(), 'shading_model': shading_model, 'textures': textures})
+    return materials
+
+
+def extract_animations(scene, node_indices, arrays, curves=True):
+    """Takes with their time spans, and the keys of every curve in
+    curves/times (FbxTime ticks) and curves/values"""
+    from fbx import FbxCriteria, FbxAnimStack, FbxAnimLayer, FbxAnimCurveNode
+
+    stack_criteria = FbxCriteria.ObjectType(FbxAnimStack.ClassId)
+    layer_criteria = FbxCriteria.ObjectType(FbxAnimLayer.ClassId)
+    curve_node_criteria = FbxCriteria.ObjectType(FbxAnimCurveNode.ClassId)
+    times, values = array('q'), array('f')
+
+    animations = []
+    for i in range(scene.GetSrcObjectCount(stack_criteria)):
+        stack = scene.GetSrcObject(stack_criteria, i)
+        if not stack:
+            continue
+
+        time_span = stack.GetLocalTimeSpan()
+        start_time, stop_time = time_span.GetStart(), time_span.GetStop()
+        animation = {
+            'name': stack.GetName(),
+            'start_time': start_time.GetSecondDouble(),
+            'end_time': stop_time.GetSecondDouble(),
+            'start_frame': start_time.GetFrameCount(),
+            'end_frame': stop_time.GetFrameCount(),
+            'layers': [],
+            'curves': [],
+        }
+
+        for l in range(stack.GetMemberCount(layer_criteria)):
+            anim_layer = stack.GetMember(layer_criteria, l)
+            animation['layers'].append(anim_layer.GetName())
+            if not curves:
+                continue
+            for j in range(anim_layer.GetMemberCount(curve_node_criteria)):
+                curve_node = anim_layer.GetMember(curve_node_criteria, j)
+                # The node property the curves drive
+                node, prop_name = -1, ""
+                for k in range(curve_node.GetDstPropertyCount()):
+                    prop = curve_node.GetDstProperty(k)
+                    owner = prop.GetFbxObject()
+                    if owner and owner.GetUniqueID() in node_indices:
+                        node, prop_name = node_indices[owner.GetUniqueID()], str(prop.GetName())
+                        break
+
+                for channel in range(curve_node.GetChannelsCount()):
+                    for c in range(curve_node.GetCurveCount(channel)):
+                        curve = curve_node.GetCurve(channel, c)
+                        key_count = curve.KeyGetCount()
+                        animation['curves'].append({
+                            'layer': l,
+                            'node': node,
+                            'property': prop_name,
+                            'channel': str(curve_node.GetChannelName(channel)),
+                            'offset': len(times),
+                            'count': key_count,
+                        })
+                        for key in range(key_count):
+                            times.append(curve.KeyGetTime(key).Get())
+                            values.append(curve.KeyGetValue(key))
+
+        animations.append(animation)
+
+    arrays['curves/times'] = times
+    arrays['curves/values'] = values
+    return animations
+
+
+def extract(scene, curves=True):
+    """Flatten an imported scene. Without curves, takes are listed without
+    their keys."""
+    arrays = {}
+    nodes_meta, nodes = extract_nodes(scene, arrays)
+    node_indices = {node.GetUniqueID(): index for index, node in enumerate(nodes)}
+
+    meta = {
+        'scene': extract_scene_info(scene),
+        'nodes': nodes_meta,
+        'meshes': extract_meshes(nodes, nodes_meta['types'], node_indices, arrays),
+        'materials': extract_materials(scene),
+        'animations': extract_animations(scene, node_indices, arrays, curves),
+    }
+    return SceneData(meta, arrays)
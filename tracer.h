@@ -0,0 +1,175 @@
+/**
+ * tracer.h - Chrome trace-event output
+ *
+ * Records named spans and writes them as Chrome trace-event JSON, which can
+ * be opened in Perfetto (ui.perfetto.dev) or chrome://tracing. Timestamps are
+ * wall-clock microseconds, matching the Python tools' --trace output, so
+ * traces from several processes can be merged into one timeline.
+ *
+ * Tracing is off until Tracer::Instance().Enable() is called; until then
+ * TraceSpan does nothing.
+ *
+ *   Tracer::Instance().Enable("fbxaxisconvert");
+ *   {
+ *       TraceSpan span("Import");
+ *       ...
+ *   }
+ *   Tracer::Instance().Write("trace.json");
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+class Tracer {
+public:
+    static Tracer& Instance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    void Enable(const char* processName) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mProcessName = processName;
+        // The enabling thread is the main track
+        ThreadIdLocked();
+        mEnabled = true;
+    }
+
+    bool IsEnabled() const { return mEnabled; }
+
+    static long long NowMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    // Record a completed span on the calling thread's track.
+    // args is an optional JSON object body, e.g. "\"file\": \"a.fbx\"".
+    void AddSpan(const std::string& name, long long startUs, long long durationUs, const std::string& args) {
+        if (!mEnabled) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        Event event;
+        event.name = name;
+        event.startUs = startUs;
+        event.durationUs = durationUs;
+        event.tid = ThreadIdLocked();
+        event.args = args;
+        mEvents.push_back(event);
+    }
+
+    bool Write(const char* path) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        FILE* file = fopen(path, "w");
+        if (!file) {
+            return false;
+        }
+
+        int pid = (int)getpid();
+        fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+        fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": 0, \"args\": {\"name\": \"%s\"}}",
+                pid, Escape(mProcessName).c_str());
+        for (std::map<std::thread::id, int>::const_iterator it = mThreadIds.begin(); it != mThreadIds.end(); ++it) {
+            fprintf(file, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+                    pid, it->second, it->second == 1 ? "main" : ("worker " + std::to_string(it->second - 1)).c_str());
+        }
+        for (size_t i = 0; i < mEvents.size(); i++) {
+            const Event& event = mEvents[i];
+            fprintf(file, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %lld, \"dur\": %lld, \"pid\": %d, \"tid\": %d",
+                    Escape(event.name).c_str(), Escape(mProcessName).c_str(), event.startUs, event.durationUs, pid, event.tid);
+            if (!event.args.empty()) {
+                fprintf(file, ", \"args\": {%s}", event.args.c_str());
+            }
+            fprintf(file, "}");
+        }
+        fprintf(file, "\n]}\n");
+        return fclose(file) == 0;
+    }
+
+    static std::string Escape(const std::string& value) {
+        std::string result;
+        for (size_t i = 0; i < value.size(); i++) {
+            char c = value[i];
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if ((unsigned char)c < 0x20) {
+                char buffer[8];
+                snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char)c);
+                result += buffer;
+            } else {
+                result += c;
+            }
+        }
+        return result;
+    }
+
+private:
+    struct Event {
+        std::string name;
+        long long startUs;
+        long long durationUs;
+        int tid;
+        std::string args;
+    };
+
+    Tracer() : mEnabled(false) {}
+
+    // Small sequential ids (1 = first thread seen) keep tracks readable
+    int ThreadIdLocked() {
+        std::thread::id id = std::this_thread::get_id();
+        std::map<std::thread::id, int>::iterator it = mThreadIds.find(id);
+        if (it != mThreadIds.end()) {
+            return it->second;
+        }
+        int tid = (int)mThreadIds.size() + 1;
+        mThreadIds[id] = tid;
+        return tid;
+    }
+
+    // Read without the mutex by TraceSpan on any thread
+    std::atomic<bool> mEnabled;
+    std::string mProcessName;
+    std::vector<Event> mEvents;
+    std::map<std::thread::id, int> mThreadIds;
+    std::mutex mMutex;
+};
+
+// Records a span from construction to destruction
+class TraceSpan {
+public:
+    explicit TraceSpan(const std::string& name, const std::string& args = std::string())
+        : mName(name), mArgs(args), mStartUs(Tracer::Instance().IsEnabled() ? Tracer::NowMicros() : 0) {}
+
+    ~TraceSpan() {
+        Tracer& tracer = Tracer::Instance();
+        if (tracer.IsEnabled()) {
+            tracer.AddSpan(mName, mStartUs, Tracer::NowMicros() - mStartUs, mArgs);
+        }
+    }
+
+private:
+    TraceSpan(const TraceSpan&);
+    TraceSpan& operator=(const TraceSpan&);
+
+    std::string mName;
+    std::string mArgs;
+    long long mStartUs;
+};
+
+// Helper for span args: "\"key\": \"value\""
+inline std::string TraceArg(const char* key, const std::string& value) {
+    return "\"" + Tracer::Escape(key) + "\": \"" + Tracer::Escape(value) + "\"";
+}
+
+#endif // TRACER_H
@@ -0,0 +1,828 @@
+/**
+ * usdinspect-native - USD file inspection tool for RealityKit animations
+ *
+ * Native counterpart of usdinspect built on the USD C++ libraries. It prints
+ * the same Markdown report, but makes one UsdPrimRange pass per stage that
+ * dispatches on the prim type, instead of one Python traversal per query,
+ * and reads skeletal animation joints through UsdSkelAnimQuery without
+ * fetching any time-sampled arrays.
+ *
+ * Usage:
+ *   usdinspect-native <input.usd> [--no-recursive] [--no-payloads] [-v] [-m]
+ *
+ * Build:
+ *   make usdinspect-native USD_ROOT=/path/to/USD
+ */
+
+#include "inspect_report.h"
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/pcp/layerStack.h>
+#include <pxr/usd/pcp/node.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primCompositionQuery.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdSkel/animQuery.h>
+#include <pxr/usd/usdSkel/animation.h>
+#include <pxr/usd/usdSkel/cache.h>
+#include <pxr/usd/usdSkel/skeleton.h>
+
+#include <map>
+#include <set>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// ---------------------------------------------------------------------------
+// Paths, handled like Python's os.path so references resolve and print the same
+// ---------------------------------------------------------------------------
+
+// os.path.normpath
+std::string NormPath(const std::string& path) {
+    if (path.empty()) {
+        return ".";
+    }
+
+    size_t initialSlashes = 0;
+    if (path[0] == '/') {
+        initialSlashes = (path.size() > 1 && path[1] == '/' && (path.size() < 3 || path[2] != '/')) ? 2 : 1;
+    }
+
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        std::string part = path.substr(start, end - start);
+        start = end + 1;
+
+        if (part.empty() || part == ".") {
+            continue;
+        }
+        if (part != ".." || (!initialSlashes && parts.empty()) || (!parts.empty() && parts.back() == "..")) {
+            parts.push_back(part);
+        } else if (!parts.empty()) {
+            parts.pop_back();
+        }
+    }
+
+    std::string result(initialSlashes, '/');
+    for (size_t i = 0; i < parts.size(); i++) {
+        result += (i > 0 ? "/" : "") + parts[i];
+    }
+    return result.empty() ? "." : result;
+}
+
+// os.path.abspath
+std::string AbsPath(const std::string& path) {
+    if (!path.empty() && path[0] == '/') {
+        return NormPath(path);
+    }
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd))) {
+        return NormPath(path);
+    }
+    return NormPath(std::string(cwd) + "/" + path);
+}
+
+// os.path.dirname
+std::string DirName(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string head = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+    if (!head.empty() && head.find_first_not_of('/') != std::string::npos) {
+        head.erase(head.find_last_not_of('/') + 1);
+    }
+    return head;
+}
+
+// os.path.join(base, path) for a path that is not absolute
+std::string JoinPath(const std::string& base, const std::string& path) {
+    if (base.empty() || base[base.size() - 1] == '/') {
+        return base + path;
+    }
+    return base + "/" + path;
+}
+
+bool PathExists(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+}
+
+// An AnimationFile's asset path as the Python tool prints it: str(path)
+// with the '@' delimiters stripped and any leading './' removed
+std::string CleanAssetPath(const std::string& assetPath) {
+    std::string path = "@" + assetPath + "@";
+    size_t first = path.find_first_not_of('@');
+    if (first == std::string::npos) {
+        return "";
+    }
+    path = path.substr(first, path.find_last_not_of('@') - first + 1);
+    size_t start = path.find_first_not_of("./");
+    return start == std::string::npos ? "" : path.substr(start);
+}
+
+// ---------------------------------------------------------------------------
+// Inspection results, mirroring the dictionaries built by usdinspect
+// ---------------------------------------------------------------------------
+
+// Prim and joint hierarchies: nodes refer to their children by index
+struct Tree {
+    struct Node {
+        std::string name;
+        std::string type;
+        std::vector<size_t> children;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<size_t> roots;
+
+    size_t Add(const std::string& name, const std::string& type) {
+        Node node;
+        node.name = name;
+        node.type = type;
+        nodes.push_back(node);
+        return nodes.size() - 1;
+    }
+};
+
+struct StageInfo {
+    std::string format;
+    double fps;
+    double startTime;
+    double endTime;
+    double duration;
+    std::string upAxis;
+    double metersPerUnit;
+};
+
+struct PrimCounts {
+    int total, meshes, materials, skeletons, skelRoots, animations, xforms;
+};
+
+struct SkelAnimationInfo {
+    std::string path;
+    std::string sourceFile;
+    size_t jointCount;
+    std::vector<std::string> channels;
+    double fps;
+    double duration;
+    long long frameCount;
+};
+
+struct SkeletonInfo {
+    std::string path;
+    size_t jointCount;
+    Tree jointTree;
+};
+
+struct AnimationLibraryInfo {
+    struct Clip {
+        std::string name;
+        double startTime;
+    };
+    struct AnimationFile {
+        std::string file;
+        std::string name;
+    };
+
+    std::string path;
+    std::vector<Clip> clips;
+    std::vector<AnimationFile> animationFiles;
+};
+
+struct BoundingBox {
+    GfVec3d min, center, max, size;
+};
+
+struct InspectResult {
+    std::string filepath;
+    std::string filename;
+    StageInfo stageInfo;
+    PrimCounts primCounts;
+    Tree primTree;
+    bool hasBoundingBox;
+    BoundingBox boundingBox;
+    std::vector<AnimationLibraryInfo> animationLibraries;
+    std::vector<SkelAnimationInfo> skelAnimations;
+    std::vector<SkeletonInfo> skeletons;
+    std::vector<std::string> references;
+    std::vector<InspectResult> referencedResults;
+};
+
+// ---------------------------------------------------------------------------
+// Stage queries
+// ---------------------------------------------------------------------------
+
+static const TfToken kMesh("Mesh");
+static const TfToken kMaterial("Material");
+static const TfToken kSkeleton("Skeleton");
+static const TfToken kSkelRoot("SkelRoot");
+static const TfToken kSkelAnimation("SkelAnimation");
+static const TfToken kXform("Xform");
+static const TfToken kRealityKitComponent("RealityKitComponent");
+static const TfToken kRealityKitClipDefinition("RealityKitClipDefinition");
+static const TfToken kRealityKitAnimationFile("RealityKitAnimationFile");
+static const TfToken kInfoId("info:id");
+static const TfToken kClipNames("clipNames");
+static const TfToken kStartTimes("startTimes");
+static const TfToken kFile("file");
+static const TfToken kName("name");
+
+bool EndsWith(const std::string& text, const char* suffix) {
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+StageInfo GetStageInfo(const UsdStageRefPtr& stage) {
+    StageInfo info;
+
+    const std::string& identifier = stage->GetRootLayer()->GetIdentifier();
+    if (EndsWith(identifier, ".usda")) {
+        info.format = "usda (ASCII)";
+    } else if (EndsWith(identifier, ".usdc")) {
+        info.format = "usdc (Binary)";
+    } else if (EndsWith(identifier, ".usdz")) {
+        info.format = "usdz (Package)";
+    } else {
+        info.format = "USD";
+    }
+
+    info.fps = stage->GetTimeCodesPerSecond();
+    info.startTime = stage->GetStartTimeCode();
+    info.endTime = stage->GetEndTimeCode();
+    if (info.fps > 0 && info.endTime >= info.startTime) {
+        info.duration = (info.endTime - info.startTime) / info.fps;
+    } else {
+        info.duration = 0.0;
+    }
+
+    info.upAxis = UsdGeomGetStageUpAxis(stage).GetString();
+    info.metersPerUnit = UsdGeomGetStageMetersPerUnit(stage);
+    return info;
+}
+
+// Joint trees from flat joint paths ("Hips", "Hips/Spine", ...). Joints whose
+// parent path is not listed before them become roots.
+Tree BuildJointTree(const VtTokenArray& jointPaths) {
+    Tree tree;
+    std::map<std::string, size_t> nodesByPath;
+
+    for (size_t i = 0; i < jointPaths.size(); i++) {
+        const std::string& path = jointPaths[i].GetString();
+        size_t slash = path.rfind('/');
+        size_t index = tree.Add(slash == std::string::npos ? path : path.substr(slash + 1), "");
+        nodesByPath[path] = index;
+
+        std::map<std::string, size_t>::const_iterator parent =
+            slash == std::string::npos ? nodesByPath.end() : nodesByPath.find(path.substr(0, slash));
+        if (parent != nodesByPath.end()) {
+            tree.nodes[parent->second].children.push_back(index);
+        } else {
+            tree.roots.push_back(index);
+        }
+    }
+    return tree;
+}
+
+SkelAnimationInfo GetSkelAnimationInfo(const UsdPrim& prim, UsdSkelCache& skelCache, const StageInfo& stageInfo,
+                                       const std::string& sourceFile) {
+    SkelAnimationInfo info;
+    info.path = prim.GetPath().GetString();
+    info.sourceFile = sourceFile;
+
+    // The query resolves the joint order without touching the per-frame
+    // translation, rotation and scale samples
+    UsdSkelAnimQuery query = skelCache.GetAnimQuery(prim);
+    info.jointCount = query ? query.GetJointOrder().size() : 0;
+
+    UsdSkelAnimation animation(prim);
+    if (animation.GetTranslationsAttr().HasValue()) {
+        info.channels.push_back("translations");
+    }
+    if (animation.GetRotationsAttr().HasValue()) {
+        info.channels.push_back("rotations");
+    }
+    if (animation.GetScalesAttr().HasValue()) {
+        info.channels.push_back("scales");
+    }
+
+    info.fps = stageInfo.fps;
+    info.duration = stageInfo.duration;
+    info.frameCount = stageInfo.fps > 0 ? (long long)(stageInfo.endTime - stageInfo.startTime) + 1 : 0;
+    return info;
+}
+
+SkeletonInfo GetSkeletonInfo(const UsdPrim& prim) {
+    SkeletonInfo info;
+    info.path = prim.GetPath().GetString();
+
+    VtTokenArray joints;
+    UsdSkelSkeleton(prim).GetJointsAttr().Get(&joints);
+    info.jointCount = joints.size();
+    info.jointTree = BuildJointTree(joints);
+    return info;
+}
+
+// A RealityKit.AnimationLibrary component with its clip definitions and
+// animation files, or false for any other RealityKitComponent
+bool GetAnimationLibraryInfo(const UsdPrim& prim, AnimationLibraryInfo& info) {
+    VtValue infoId;
+    UsdAttribute infoIdAttr = prim.GetAttribute(kInfoId);
+    if (!infoIdAttr || !infoIdAttr.Get(&infoId)) {
+        return false;
+    }
+    std::string id = infoId.IsHolding<TfToken>() ? infoId.UncheckedGet<TfToken>().GetString()
+                   : infoId.IsHolding<std::string>() ? infoId.UncheckedGet<std::string>() : "";
+    if (id != "RealityKit.AnimationLibrary") {
+        return false;
+    }
+
+    info.path = prim.GetPath().GetString();
+
+    for (const UsdPrim& child : prim.GetChildren()) {
+        const TfToken& childType = child.GetTypeName();
+
+        if (childType == kRealityKitClipDefinition) {
+            VtValue namesValue, startTimesValue;
+            UsdAttribute namesAttr = child.GetAttribute(kClipNames);
+            UsdAttribute startTimesAttr = child.GetAttribute(kStartTimes);
+            if (namesAttr) {
+                namesAttr.Get(&namesValue);
+            }
+            if (startTimesAttr) {
+                startTimesAttr.Get(&startTimesValue);
+            }
+
+            std::vector<std::string> names;
+            if (namesValue.IsHolding<VtStringArray>()) {
+                const VtStringArray& values = namesValue.UncheckedGet<VtStringArray>();
+                names.assign(values.begin(), values.end());
+            } else if (namesValue.IsHolding<VtTokenArray>()) {
+                for (const TfToken& name : namesValue.UncheckedGet<VtTokenArray>()) {
+                    names.push_back(name.GetString());
+                }
+            }
+
+            std::vector<double> startTimes;
+            if (startTimesValue.IsHolding<VtDoubleArray>()) {
+                const VtDoubleArray& values = startTimesValue.UncheckedGet<VtDoubleArray>();
+                startTimes.assign(values.begin(), values.end());
+            } else if (startTimesValue.IsHolding<VtFloatArray>()) {
+                const VtFloatArray& values = startTimesValue.UncheckedGet<VtFloatArray>();
+                startTimes.assign(values.begin(), values.end());
+            }
+
+            for (size_t i = 0; i < names.size(); i++) {
+                AnimationLibraryInfo::Clip clip;
+                clip.name = names[i];
+                clip.startTime = i < startTimes.size() ? startTimes[i] : 0.0;
+                info.clips.push_back(clip);
+            }
+        } else if (childType == kRealityKitAnimationFile) {
+            UsdAttribute fileAttr = child.GetAttribute(kFile);
+            if (!fileAttr) {
+                continue;
+            }
+            SdfAssetPath assetPath;
+            fileAttr.Get(&assetPath);
+            if (assetPath.GetAssetPath().empty()) {
+                continue;
+            }
+
+            AnimationLibraryInfo::AnimationFile animationFile;
+            animationFile.file = assetPath.GetAssetPath();
+            UsdAttribute nameAttr = child.GetAttribute(kName);
+            if (nameAttr) {
+                nameAttr.Get(&animationFile.name);
+            }
+            info.animationFiles.push_back(animationFile);
+        }
+    }
+    return true;
+}
+
+// Layers brought in by the prim's own references
+void AddDirectReferences(const UsdPrim& prim, const std::string& rootId, const std::string& baseDir,
+                         std::set<std::string>& references) {
+    UsdPrimCompositionQuery query = UsdPrimCompositionQuery::GetDirectReferences(prim);
+    for (const UsdPrimCompositionQueryArc& arc : query.GetCompositionArcs()) {
+        PcpNodeRef targetNode = arc.GetTargetNode();
+        if (!targetNode || !targetNode.GetLayerStack()) {
+            continue;
+        }
+        for (const SdfLayerRefPtr& layer : targetNode.GetLayerStack()->GetLayers()) {
+            const std::string& layerId = layer->GetIdentifier();
+            if (layerId.empty() || layerId == rootId) {
+                continue;
+            }
+            std::string refPath = layerId[0] == '/' ? layerId : JoinPath(baseDir, layerId);
+            if (PathExists(refPath)) {
+                references.insert(NormPath(refPath));
+            }
+        }
+    }
+}
+
+bool InspectFile(const std::string& inputPath, bool recursive, bool loadPayloads, std::set<std::string>& visited,
+                 InspectResult& result) {
+    std::string filepath = AbsPath(inputPath);
+    if (!visited.insert(filepath).second) {
+        return false;
+    }
+
+    if (!PathExists(filepath)) {
+        fprintf(stderr, "Error: File not found: %s\n", filepath.c_str());
+        return false;
+    }
+
+    UsdStageRefPtr stage = UsdStage::Open(filepath, loadPayloads ? UsdStage::LoadAll : UsdStage::LoadNone);
+    if (!stage) {
+        fprintf(stderr, "Error opening %s: Failed to open stage\n", filepath.c_str());
+        return false;
+    }
+
+    std::string baseDir = DirName(filepath);
+    std::string rootId = stage->GetRootLayer()->GetIdentifier();
+
+    result.filepath = filepath;
+    result.filename = Basename(filepath.c_str());
+    result.stageInfo = GetStageInfo(stage);
+    memset(&result.primCounts, 0, sizeof(result.primCounts));
+
+    // One pass over the stage collects everything. Traverse() and
+    // GetChildren() use the same predicate, so the prim tree can be built
+    // from the pre-order traversal by looking up each prim's parent.
+    UsdSkelCache skelCache;
+    std::set<std::string> references;
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> treeNodes;
+    PrimCounts& counts = result.primCounts;
+
+    for (const UsdPrim& prim : stage->Traverse()) {
+        const TfToken& typeName = prim.GetTypeName();
+        counts.total++;
+
+        size_t node = result.primTree.Add(prim.GetName().GetString(), typeName.GetString());
+        treeNodes[prim.GetPath()] = node;
+        std::unordered_map<SdfPath, size_t, SdfPath::Hash>::const_iterator parent =
+            treeNodes.find(prim.GetPath().GetParentPath());
+        if (parent != treeNodes.end()) {
+            result.primTree.nodes[parent->second].children.push_back(node);
+        } else {
+            result.primTree.roots.push_back(node);
+        }
+
+        if (typeName == kMesh) {
+            counts.meshes++;
+        } else if (typeName == kMaterial) {
+            counts.materials++;
+        } else if (typeName == kSkeleton) {
+            counts.skeletons++;
+            result.skeletons.push_back(GetSkeletonInfo(prim));
+        } else if (typeName == kSkelRoot) {
+            counts.skelRoots++;
+        } else if (typeName == kSkelAnimation) {
+            counts.animations++;
+            result.skelAnimations.push_back(GetSkelAnimationInfo(prim, skelCache, result.stageInfo, result.filename));
+        } else if (typeName == kXform) {
+            counts.xforms++;
+        } else if (typeName == kRealityKitComponent) {
+            AnimationLibraryInfo library;
+            if (GetAnimationLibraryInfo(prim, library)) {
+                result.animationLibraries.push_back(library);
+            }
+        }
+
+        // Composition queries are expensive; only prims with references
+        // authored on them can have direct reference arcs
+        if (prim.HasAuthoredReferences()) {
+            AddDirectReferences(prim, rootId, baseDir, references);
+        }
+    }
+
+    UsdGeomBBoxCache bboxCache(UsdTimeCode::Default(), TfTokenVector{UsdGeomTokens->default_, UsdGeomTokens->render});
+    GfRange3d range = bboxCache.ComputeWorldBound(stage->GetPseudoRoot()).ComputeAlignedRange();
+    result.hasBoundingBox = !range.IsEmpty();
+    if (result.hasBoundingBox) {
+        result.boundingBox.min = range.GetMin();
+        result.boundingBox.max = range.GetMax();
+        result.boundingBox.size = range.GetMax() - range.GetMin();
+        result.boundingBox.center = (range.GetMin() + range.GetMax()) / 2;
+    }
+
+    // Sublayers
+    std::vector<std::string> subLayerPaths = stage->GetRootLayer()->GetSubLayerPaths();
+    for (const std::string& subLayerPath : subLayerPaths) {
+        std::string path = !subLayerPath.empty() && subLayerPath[0] == '/' ? subLayerPath : JoinPath(baseDir, subLayerPath);
+        if (PathExists(path)) {
+            references.insert(NormPath(path));
+        }
+    }
+
+    // RealityKit animation files
+    for (const AnimationLibraryInfo& library : result.animationLibraries) {
+        for (const AnimationLibraryInfo::AnimationFile& animationFile : library.animationFiles) {
+            std::string file = CleanAssetPath(animationFile.file);
+            std::string path = !file.empty() && file[0] == '/' ? file : JoinPath(baseDir, file);
+            if (PathExists(path)) {
+                references.insert(NormPath(path));
+            }
+        }
+    }
+
+    for (const std::string& reference : references) {
+        result.references.push_back(Basename(reference.c_str()));
+    }
+
+    // Release the stage before opening the referenced files
+    stage = UsdStageRefPtr();
+
+    if (recursive) {
+        for (const std::string& reference : references) {
+            InspectResult referencedResult;
+            if (InspectFile(reference, true, loadPayloads, visited, referencedResult)) {
+                result.referencedResults.push_back(referencedResult);
+            }
+        }
+    }
+    return true;
+}
+
+void CollectAll(const InspectResult& result, std::vector<const AnimationLibraryInfo*>& libraries,
+                std::vector<const SkelAnimationInfo*>& animations, std::vector<const SkeletonInfo*>& skeletons) {
+    for (const AnimationLibraryInfo& library : result.animationLibraries) {
+        libraries.push_back(&library);
+    }
+    for (const SkelAnimationInfo& animation : result.skelAnimations) {
+        animations.push_back(&animation);
+    }
+    for (const SkeletonInfo& skeleton : result.skeletons) {
+        skeletons.push_back(&skeleton);
+    }
+    for (const InspectResult& referencedResult : result.referencedResults) {
+        CollectAll(referencedResult, libraries, animations, skeletons);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Markdown output
+// ---------------------------------------------------------------------------
+
+void PrintTree(std::string& out, const Tree& tree, const std::vector<size_t>& level, const std::string& prefix,
+               bool isRoot) {
+    for (size_t i = 0; i < level.size(); i++) {
+        const Tree::Node& node = tree.nodes[level[i]];
+        bool isLast = i + 1 == level.size();
+        std::string connector = isRoot ? "" : (isLast ? "└── " : "├── ");
+        std::string childPrefix = isRoot ? "" : (isLast ? "    " : "│   ");
+
+        out += prefix + connector + node.name;
+        if (!node.type.empty()) {
+            out += " (" + node.type + ")";
+        }
+        out += "\n";
+
+        if (!node.children.empty()) {
+            PrintTree(out, tree, node.children, prefix + childPrefix, false);
+        }
+    }
+}
+
+std::string PointString(const GfVec3d& point) {
+    return "(" + Fixed(point[0], 4) + ", " + Fixed(point[1], 4) + ", " + Fixed(point[2], 4) + ")";
+}
+
+void PrintDefaultOutput(std::string& out, const InspectResult& result, bool verbose) {
+    const StageInfo& info = result.stageInfo;
+    const PrimCounts& counts = result.primCounts;
+
+    out += "# " + result.filename + "\n\n";
+
+    // Stage info
+    out += "## Stage Info\n\n";
+    std::vector<Row> stageRows;
+    stageRows.push_back(Row{"Format", info.format});
+    stageRows.push_back(Row{"FPS", PyFloat(info.fps)});
+    if (info.duration > 0) {
+        stageRows.push_back(Row{"Time Range", PyFloat(info.startTime) + " - " + PyFloat(info.endTime) + " (" +
+                                              Fixed(info.duration, 2) + "s)"});
+    } else {
+        stageRows.push_back(Row{"Time Range", "(not set)"});
+    }
+    stageRows.push_back(Row{"Up Axis", info.upAxis});
+    stageRows.push_back(Row{"Meters Per Unit", PyFloat(info.metersPerUnit)});
+    PrintMarkdownTable(out, Row{"Property", "Value"}, stageRows);
+    out += "\n";
+
+    // Prim summary
+    out += "## Prim Summary\n\n";
+    std::vector<Row> primRows;
+    primRows.push_back(Row{"Total prims", Int(counts.total)});
+    if (counts.meshes > 0) {
+        primRows.push_back(Row{"Meshes", Int(counts.meshes)});
+    }
+    if (counts.materials > 0) {
+        primRows.push_back(Row{"Materials", Int(counts.materials)});
+    }
+    if (counts.skeletons > 0) {
+        primRows.push_back(Row{"Skeletons", Int(counts.skeletons)});
+    }
+    if (counts.skelRoots > 0) {
+        primRows.push_back(Row{"SkelRoots", Int(counts.skelRoots)});
+    }
+    if (counts.xforms > 0 && verbose) {
+        primRows.push_back(Row{"Xforms", Int(counts.xforms)});
+    }
+    PrintMarkdownTable(out, Row{"Type", "Count"}, primRows);
+    out += "\n";
+
+    // Bounding box
+    if (result.hasBoundingBox) {
+        out += "## Bounding Box\n\n";
+        std::string unit;
+        if (info.metersPerUnit == 1.0) {
+            unit = "m";
+        } else if (info.metersPerUnit == 0.01) {
+            unit = "cm";
+        } else if (info.metersPerUnit == 0.001) {
+            unit = "mm";
+        } else {
+            unit = "(" + PyFloat(info.metersPerUnit) + "m)";
+        }
+        const BoundingBox& bbox = result.boundingBox;
+        std::vector<Row> bboxRows;
+        bboxRows.push_back(Row{"Min", PointString(bbox.min)});
+        bboxRows.push_back(Row{"Center", PointString(bbox.center)});
+        bboxRows.push_back(Row{"Max", PointString(bbox.max)});
+        bboxRows.push_back(Row{"Size", Fixed(bbox.size[0], 4) + " x " + Fixed(bbox.size[1], 4) + " x " +
+                                       Fixed(bbox.size[2], 4) + " " + unit});
+        PrintMarkdownTable(out, Row{"Property", "Value"}, bboxRows);
+        out += "\n";
+    }
+
+    // Prim tree (already includes composed prims from references)
+    out += "## Prim Hierarchy\n\n```\n";
+    PrintTree(out, result.primTree, result.primTree.roots, "", true);
+    out += "```\n\n";
+
+    // Referenced files
+    if (!result.references.empty()) {
+        Appendf(out, "## Referenced Files (%zu)\n\n", result.references.size());
+        for (const std::string& reference : result.references) {
+            out += "- `" + reference + "`\n";
+        }
+        out += "\n";
+    }
+
+    std::vector<const AnimationLibraryInfo*> allLibraries;
+    std::vector<const SkelAnimationInfo*> allAnimations;
+    std::vector<const SkeletonInfo*> allSkeletons;
+    CollectAll(result, allLibraries, allAnimations, allSkeletons);
+
+    // Skeleton hierarchy
+    for (const SkeletonInfo* skeleton : allSkeletons) {
+        Appendf(out, "## Skeleton Hierarchy (%zu joints)\n\n", skeleton->jointCount);
+        out += "**Path:** `" + skeleton->path + "`\n\n";
+        if (!skeleton->jointTree.roots.empty()) {
+            out += "```\n";
+            PrintTree(out, skeleton->jointTree, skeleton->jointTree.roots, "", true);
+            out += "```\n\n";
+        }
+    }
+
+    // Animation libraries
+    for (const AnimationLibraryInfo* library : allLibraries) {
+        out += "## RealityKit Animation Library\n\n";
+        out += "**Path:** `" + library->path + "`\n\n";
+
+        if (!library->clips.empty()) {
+            out += "### Clip Definitions\n\n";
+            std::vector<Row> clipRows;
+            for (const AnimationLibraryInfo::Clip& clip : library->clips) {
+                clipRows.push_back(Row{clip.name, PyFloat(clip.startTime) + "s"});
+            }
+            PrintMarkdownTable(out, Row{"Name", "Start Time"}, clipRows);
+            out += "\n";
+        }
+
+        if (!library->animationFiles.empty()) {
+            out += "### Animations\n\n";
+            std::vector<Row> animRows;
+            for (const AnimationLibraryInfo::AnimationFile& animationFile : library->animationFiles) {
+                std::string name = animationFile.name.empty() ? "-" : animationFile.name;
+                animRows.push_back(Row{name, "`" + CleanAssetPath(animationFile.file) + "`"});
+            }
+            PrintMarkdownTable(out, Row{"Name", "File"}, animRows);
+            out += "\n";
+        }
+    }
+
+    // Skeletal animations from all files
+    if (!allAnimations.empty()) {
+        out += "## Skeletal Animations\n\n";
+        std::vector<Row> skelRows;
+        for (const SkelAnimationInfo* anim : allAnimations) {
+            std::string channels;
+            for (size_t i = 0; i < anim->channels.size(); i++) {
+                channels += (i > 0 ? ", " : "") + anim->channels[i];
+            }
+            skelRows.push_back(Row{
+                "`" + anim->sourceFile + "`",
+                "`" + anim->path + "`",
+                anim->duration > 0 ? Fixed(anim->duration, 2) + "s" : "-",
+                anim->frameCount > 0 ? Int(anim->frameCount) : "-",
+                anim->fps > 0 ? PyFloat(anim->fps) : "-",
+                anim->jointCount > 0 ? Int(anim->jointCount) : "-",
+                channels.empty() ? "-" : channels,
+            });
+        }
+        PrintMarkdownTable(out, Row{"Source", "Path", "Duration", "Frames", "FPS", "Joints", "Channels"}, skelRows);
+        out += "\n";
+    }
+
+    if (allLibraries.empty() && allAnimations.empty()) {
+        out += "*No animations found.*\n";
+    }
+}
+
+void PrintUsage(const char* programName) {
+    fprintf(stderr, "Usage: %s <input.usd> [options]\n", programName);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Inspect USD files for RealityKit animations and statistics.\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  --no-recursive         Don't follow USD references (default: follows references)\n");
+    fprintf(stderr, "  --no-payloads          Open stages without loading payloads\n");
+    fprintf(stderr, "  -v, --verbose          Show detailed information\n");
+    fprintf(stderr, "  -m, --marked           Copy output to pasteboard and open in Marked 2\n");
+    fprintf(stderr, "  -h, --help             Show this help message\n");
+}
+
+int main(int argc, char** argv) {
+    const char* inputPath = nullptr;
+    bool recursive = true;
+    bool loadPayloads = true;
+    bool verbose = false;
+    bool marked = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--no-recursive") == 0) {
+            recursive = false;
+        } else if (strcmp(argv[i], "--no-payloads") == 0) {
+            loadPayloads = false;
+        } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "-m") == 0 || strcmp(argv[i], "--marked") == 0) {
+            marked = true;
+        } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Error: Unknown option: %s\n", argv[i]);
+            PrintUsage(argv[0]);
+            return 1;
+        } else if (!inputPath) {
+            inputPath = argv[i];
+        }
+    }
+
+    if (!inputPath) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!PathExists(inputPath)) {
+        fprintf(stderr, "Error: File not found: %s\n", inputPath);
+        return 1;
+    }
+
+    std::set<std::string> visited;
+    InspectResult result;
+    if (!InspectFile(inputPath, recursive, loadPayloads, visited, result)) {
+        return 1;
+    }
+
+    std::string out;
+    PrintDefaultOutput(out, result, verbose);
+
+    if (marked) {
+        if (!OpenInMarked(out)) {
+            return 1;
+        }
+    } else {
+        fwrite(out.data(), 1, out.size(), stdout);
+    }
+    return 0;
+}